@@ -0,0 +1,134 @@
+#include <random>
+#include "Bench.hpp"
+#include "Util/ConcurrentMap.hpp"
+#include "Util/Typedefs.hpp"
+
+using namespace Invasion::Bench;
+using namespace Invasion::Util;
+
+// Uncontended cost of the BasicMap lock policies on a single thread. The map is small enough to stay in cache, so the
+// numbers are dominated by the lock each call takes. ConcurrentMap, the striped alternative, is listed for reference.
+
+namespace
+{
+	constexpr size_t KEY_COUNT = 1024;
+	constexpr size_t OPERATION_COUNT = 1 << 20;
+
+	Vector<uint64_t> CreateKeys()
+	{
+		std::mt19937_64 random(42);
+		Vector<uint64_t> keys;
+		keys.Resize(KEY_COUNT);
+
+		for (uint64_t& key : keys)
+			key = random();
+
+		return keys;
+	}
+
+	struct Results
+	{
+		double contains;
+		double find;
+		double write;
+	};
+
+	// BasicMap and ConcurrentMap share Contains and Find; only the write differs.
+	template <typename M, typename W>
+	Results MeasureMap(M& map, const Vector<uint64_t>& keys, W&& write)
+	{
+		Results results;
+
+		results.contains = Benchmark::Measure(OPERATION_COUNT, [&](Stopwatch& stopwatch)
+		{
+			stopwatch.Time([&]
+			{
+				uint64_t hits = 0;
+
+				for (size_t i = 0; i < OPERATION_COUNT; ++i)
+					hits += map.Contains(keys[i % KEY_COUNT]);
+
+				Benchmark::Consume(hits);
+			});
+		});
+
+		results.find = Benchmark::Measure(OPERATION_COUNT, [&](Stopwatch& stopwatch)
+		{
+			stopwatch.Time([&]
+			{
+				uint64_t sum = 0;
+				uint64_t value = 0;
+
+				for (size_t i = 0; i < OPERATION_COUNT; ++i)
+				{
+					if (map.Find(keys[i % KEY_COUNT], value))
+						sum += value;
+				}
+
+				Benchmark::Consume(sum);
+			});
+		});
+
+		results.write = Benchmark::Measure(OPERATION_COUNT, [&](Stopwatch& stopwatch)
+		{
+			stopwatch.Time([&]
+			{
+				for (size_t i = 0; i < OPERATION_COUNT; ++i)
+					write(keys[i % KEY_COUNT], i);
+			});
+		});
+
+		return results;
+	}
+
+	template <typename Lock>
+	Results MeasurePolicy(const Vector<uint64_t>& keys)
+	{
+		UnorderedMap<uint64_t, uint64_t, Lock> map;
+
+		for (uint64_t key : keys)
+			map[key] = key;
+
+		return MeasureMap(map, keys, [&map](uint64_t key, uint64_t value) { map[key] = value; });
+	}
+
+	Results MeasureConcurrentMap(const Vector<uint64_t>& keys)
+	{
+		ConcurrentMap<uint64_t, uint64_t> map;
+
+		for (uint64_t key : keys)
+			map.Insert(key, key);
+
+		return MeasureMap(map, keys, [&map](uint64_t key, uint64_t value) { map.Insert(key, value); });
+	}
+}
+
+int main()
+{
+	Vector<uint64_t> keys = CreateKeys();
+
+	Results mutexLock = MeasurePolicy<MutexLock>(keys);
+	Results sharedMutexLock = MeasurePolicy<SharedMutexLock>(keys);
+	Results noLock = MeasurePolicy<NoLock>(keys);
+	Results concurrent = MeasureConcurrentMap(keys);
+
+	Benchmark::Section("Contains (1024 keys, one thread)");
+	Benchmark::Report("MutexLock", mutexLock.contains);
+	Benchmark::Report("SharedMutexLock", sharedMutexLock.contains, mutexLock.contains);
+	Benchmark::Report("NoLock", noLock.contains, mutexLock.contains);
+	Benchmark::Report("ConcurrentMap", concurrent.contains, mutexLock.contains);
+
+	Benchmark::Section("Find (1024 keys, one thread)");
+	Benchmark::Report("MutexLock", mutexLock.find);
+	Benchmark::Report("SharedMutexLock", sharedMutexLock.find, mutexLock.find);
+	Benchmark::Report("NoLock", noLock.find, mutexLock.find);
+	Benchmark::Report("ConcurrentMap", concurrent.find, mutexLock.find);
+
+	Benchmark::Section("Overwrite (1024 keys, one thread)");
+	Benchmark::Report("MutexLock", mutexLock.write);
+	Benchmark::Report("SharedMutexLock", sharedMutexLock.write, mutexLock.write);
+	Benchmark::Report("NoLock", noLock.write, mutexLock.write);
+	Benchmark::Report("ConcurrentMap", concurrent.write, mutexLock.write);
+
+	return 0;
+}
\ No newline at end of file
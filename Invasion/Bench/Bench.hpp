@@ -0,0 +1,100 @@
+#pragma once
+
+// Standalone microbenchmarks. Every .cpp in this directory is its own program with its own main() and is not part of
+// Invasion.vcxproj. Build one from a developer command prompt at the repository root, for example:
+//
+//     cl /std:c++latest /O2 /EHsc /DNDEBUG /I Invasion\Include /I Invasion\Bench Invasion\Bench\ThreadPoolBench.cpp
+//
+// Each benchmark prints the best of several runs in nanoseconds per operation, plus the speedup over its baseline.
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+
+namespace Invasion::Bench
+{
+	class Stopwatch
+	{
+
+	public:
+
+		using Clock = std::chrono::steady_clock;
+
+		template <typename F>
+		void Time(F&& function)
+		{
+			Clock::time_point start = Clock::now();
+
+			function();
+
+			elapsed += Clock::now() - start;
+		}
+
+		double GetNanoseconds() const
+		{
+			return std::chrono::duration<double, std::nano>(elapsed).count();
+		}
+
+	private:
+
+		Clock::duration elapsed = Clock::duration::zero();
+
+	};
+
+	class Benchmark
+	{
+
+	public:
+
+		Benchmark(const Benchmark&) = delete;
+		Benchmark& operator=(const Benchmark&) = delete;
+
+		// Runs the function several times and returns the best time per operation. The function receives a Stopwatch
+		// and wraps only the part being measured, so setup and teardown stay out of the numbers.
+		template <typename F>
+		static double Measure(size_t operations, F&& function)
+		{
+			double best = std::numeric_limits<double>::max();
+
+			for (size_t run = 0; run < REPETITIONS; ++run)
+			{
+				Stopwatch stopwatch;
+
+				function(stopwatch);
+
+				best = std::min(best, stopwatch.GetNanoseconds() / static_cast<double>(operations));
+			}
+
+			return best;
+		}
+
+		static void Report(const char* name, double nanoseconds, double baseline = 0.0)
+		{
+			if (baseline > 0.0)
+				std::printf("%-48s %10.2f ns/op %8.2fx\n", name, nanoseconds, baseline / nanoseconds);
+			else
+				std::printf("%-48s %10.2f ns/op\n", name, nanoseconds);
+		}
+
+		static void Section(const char* name)
+		{
+			std::printf("\n%s\n", name);
+		}
+
+		// Folds a result into a volatile sink so the optimizer cannot discard the work that produced it.
+		static void Consume(uint64_t value)
+		{
+			sink = sink + value;
+		}
+
+	private:
+
+		static constexpr size_t REPETITIONS = 5;
+
+		static inline volatile uint64_t sink = 0;
+
+	};
+}
\ No newline at end of file
@@ -0,0 +1,141 @@
+#include <algorithm>
+#include <random>
+#include "Bench.hpp"
+#include "Util/Typedefs.hpp"
+
+using namespace Invasion::Bench;
+using namespace Invasion::Util;
+
+// FlatMap against the UnorderedMap and OrderedMap backends with 100k uint64 keys. All three go through BasicMap with
+// the NoLock policy, so only the backing container differs.
+
+namespace
+{
+	constexpr size_t KEY_COUNT = 100000;
+
+	struct Results
+	{
+		double insert;
+		double findHit;
+		double findMiss;
+		double iterate;
+		double erase;
+	};
+
+	template <typename M>
+	Results MeasureBackend(const Vector<uint64_t>& keys, const Vector<uint64_t>& shuffled, const Vector<uint64_t>& missing)
+	{
+		auto fill = [&keys](M& map)
+		{
+			for (uint64_t key : keys)
+				map[key] = key;
+		};
+
+		Results results;
+
+		results.insert = Benchmark::Measure(KEY_COUNT, [&](Stopwatch& stopwatch)
+		{
+			M map;
+			stopwatch.Time([&] { fill(map); });
+		});
+
+		M map;
+		fill(map);
+
+		results.findHit = Benchmark::Measure(KEY_COUNT, [&](Stopwatch& stopwatch)
+		{
+			stopwatch.Time([&]
+			{
+				uint64_t sum = 0;
+				uint64_t value = 0;
+
+				for (uint64_t key : shuffled)
+				{
+					if (map.Find(key, value))
+						sum += value;
+				}
+
+				Benchmark::Consume(sum);
+			});
+		});
+
+		results.findMiss = Benchmark::Measure(KEY_COUNT, [&](Stopwatch& stopwatch)
+		{
+			stopwatch.Time([&]
+			{
+				uint64_t hits = 0;
+
+				for (uint64_t key : missing)
+					hits += map.Contains(key);
+
+				Benchmark::Consume(hits);
+			});
+		});
+
+		results.iterate = Benchmark::Measure(KEY_COUNT, [&](Stopwatch& stopwatch)
+		{
+			stopwatch.Time([&]
+			{
+				uint64_t sum = 0;
+
+				map.ForEach([&sum](const uint64_t&, uint64_t& value) { sum += value; });
+
+				Benchmark::Consume(sum);
+			});
+		});
+
+		results.erase = Benchmark::Measure(KEY_COUNT, [&](Stopwatch& stopwatch)
+		{
+			M erased;
+			fill(erased);
+
+			stopwatch.Time([&]
+			{
+				for (uint64_t key : shuffled)
+					erased -= key;
+			});
+		});
+
+		return results;
+	}
+
+	void Report(const char* operation, double Results::* field, const Results& flat, const Results& unordered, const Results& ordered)
+	{
+		Benchmark::Section(operation);
+		Benchmark::Report("OrderedMap (std::map)", ordered.*field);
+		Benchmark::Report("UnorderedMap (std::unordered_map)", unordered.*field, ordered.*field);
+		Benchmark::Report("FlatMap (FlatHashMap)", flat.*field, ordered.*field);
+		std::printf("%-48s %25.2fx\n", "FlatMap vs UnorderedMap", unordered.*field / flat.*field);
+	}
+}
+
+int main()
+{
+	std::mt19937_64 random(42);
+
+	Vector<uint64_t> keys;
+	Vector<uint64_t> missing;
+	keys.Resize(KEY_COUNT);
+	missing.Resize(KEY_COUNT);
+
+	for (size_t i = 0; i < KEY_COUNT; ++i)
+	{
+		keys[i] = random() << 1;
+		missing[i] = (random() << 1) | 1;
+	}
+
+	Vector<uint64_t> shuffled = keys;
+	std::shuffle(shuffled.begin(), shuffled.end(), random);
+
+	Results flat = MeasureBackend<FlatMap<uint64_t, uint64_t, NoLock>>(keys, shuffled, missing);
+	Results unordered = MeasureBackend<UnorderedMap<uint64_t, uint64_t, NoLock>>(keys, shuffled, missing);
+	Results ordered = MeasureBackend<OrderedMap<uint64_t, uint64_t, NoLock>>(keys, shuffled, missing);
+
+	Report("Insert (100k keys)", &Results::insert, flat, unordered, ordered);
+	Report("Find, hit, shuffled (100k keys)", &Results::findHit, flat, unordered, ordered);
+	Report("Find, miss (100k keys)", &Results::findMiss, flat, unordered, ordered);
+	Report("Iterate (100k keys)", &Results::iterate, flat, unordered, ordered);
+	Report("Erase, shuffled (100k keys)", &Results::erase, flat, unordered, ordered);
+
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,218 @@
+#include <algorithm>
+#include <random>
+#include <string>
+#include "Bench.hpp"
+#include "ECS/GameObjectManager.hpp"
+
+using namespace Invasion::Bench;
+using namespace Invasion::ECS;
+
+// Register, lookup, update and unregister of 100k GameObjects in the handle-based GameObjectManager against the
+// name-keyed OrderedMap registry it replaced. Objects are rebuilt for every run outside the timed sections, and both
+// registries call CleanUp on unregister.
+
+namespace
+{
+	constexpr size_t OBJECT_COUNT = 100000;
+
+	// The pre-handle registry: everything keyed by name in a red-black tree.
+	class LegacyGameObjectManager
+	{
+
+	public:
+
+		Shared<GameObject> Register(Shared<GameObject> gameObject)
+		{
+			LockGuard<Mutex> lock(mutex);
+
+			String name = gameObject->GetName();
+
+			gameObjects |= { name, gameObject };
+
+			return gameObjects[name];
+		}
+
+		Shared<GameObject> Get(const String& name)
+		{
+			LockGuard<Mutex> lock(mutex);
+
+			if (gameObjects.Contains(name))
+				return gameObjects[name];
+			else
+				return nullptr;
+		}
+
+		void Unregister(const String& name)
+		{
+			LockGuard<Mutex> lock(mutex);
+
+			if (gameObjects.Contains(name))
+			{
+				gameObjects[name]->CleanUp();
+				gameObjects[name].reset();
+				gameObjects -= name;
+			}
+		}
+
+		void Update()
+		{
+			LockGuard<Mutex> lock(mutex);
+
+			gameObjects.ForEach([](String, Shared<GameObject> gameObject) { gameObject->Update(); });
+		}
+
+	private:
+
+		Mutex mutex;
+		OrderedMap<String, Shared<GameObject>> gameObjects;
+
+	};
+
+	Vector<Shared<GameObject>> CreateObjects()
+	{
+		Vector<Shared<GameObject>> objects;
+		objects.Reserve(OBJECT_COUNT);
+
+		for (size_t i = 0; i < OBJECT_COUNT; ++i)
+			objects += GameObject::Create(String(std::string("Object_") + std::to_string(i)));
+
+		return objects;
+	}
+
+	Vector<size_t> CreateShuffledOrder()
+	{
+		Vector<size_t> order;
+		order.Resize(OBJECT_COUNT);
+
+		for (size_t i = 0; i < OBJECT_COUNT; ++i)
+			order[i] = i;
+
+		std::shuffle(order.begin(), order.end(), std::mt19937(42));
+
+		return order;
+	}
+
+	struct Timings
+	{
+		double registration;
+		double lookup;
+		double update;
+		double unregistration;
+	};
+
+	Timings MeasureLegacy(const Vector<size_t>& order)
+	{
+		Timings timings;
+
+		// Lookup and update leave the objects alive, so the unregister that tears each run down is not timed.
+		auto measurePhase = [&order](bool timeRegister, bool timeLookup, bool timeUpdate, bool timeUnregister)
+		{
+			return Benchmark::Measure(OBJECT_COUNT, [&](Stopwatch& stopwatch)
+			{
+				Vector<Shared<GameObject>> objects = CreateObjects();
+				Vector<String> names;
+				names.Reserve(OBJECT_COUNT);
+
+				for (Shared<GameObject>& object : objects)
+					names += object->GetName();
+
+				LegacyGameObjectManager manager;
+
+				auto registerAll = [&] { for (Shared<GameObject>& object : objects) manager.Register(object); };
+				auto lookupAll = [&] { for (size_t index : order) Benchmark::Consume(manager.Get(names[index]) != nullptr); };
+				auto updateAll = [&] { manager.Update(); };
+				auto unregisterAll = [&] { for (size_t index : order) manager.Unregister(names[index]); };
+
+				timeRegister ? stopwatch.Time(registerAll) : registerAll();
+
+				if (timeLookup)
+					stopwatch.Time(lookupAll);
+
+				if (timeUpdate)
+					stopwatch.Time(updateAll);
+
+				timeUnregister ? stopwatch.Time(unregisterAll) : unregisterAll();
+			});
+		};
+
+		timings.registration = measurePhase(true, false, false, false);
+		timings.lookup = measurePhase(false, true, false, false);
+		timings.update = measurePhase(false, false, true, false);
+		timings.unregistration = measurePhase(false, false, false, true);
+
+		return timings;
+	}
+
+	Timings MeasureHandles(const Vector<size_t>& order, bool indexName)
+	{
+		Timings timings;
+
+		// A pool with no workers runs Update inline, so both registries iterate on one thread.
+		ThreadPool threadPool(0);
+		GameObjectManager& manager = GameObjectManager::GetInstance();
+
+		auto measurePhase = [&](bool timeRegister, bool timeLookup, bool timeUpdate, bool timeUnregister)
+		{
+			return Benchmark::Measure(OBJECT_COUNT, [&](Stopwatch& stopwatch)
+			{
+				Vector<Shared<GameObject>> objects = CreateObjects();
+				Vector<GameObjectHandle> handles;
+				handles.Resize(OBJECT_COUNT);
+
+				auto registerAll = [&] { for (Shared<GameObject>& object : objects) manager.Register(object, indexName); };
+				auto lookupAll = [&] { for (size_t index : order) Benchmark::Consume(manager.Get(handles[index]) != nullptr); };
+				auto updateAll = [&] { manager.Update(threadPool); };
+				auto unregisterAll = [&] { for (size_t index : order) manager.Unregister(handles[index]); };
+
+				timeRegister ? stopwatch.Time(registerAll) : registerAll();
+
+				for (size_t i = 0; i < OBJECT_COUNT; ++i)
+					handles[i] = objects[i]->GetHandle();
+
+				if (timeLookup)
+					stopwatch.Time(lookupAll);
+
+				if (timeUpdate)
+					stopwatch.Time(updateAll);
+
+				timeUnregister ? stopwatch.Time(unregisterAll) : unregisterAll();
+			});
+		};
+
+		timings.registration = measurePhase(true, false, false, false);
+		timings.lookup = measurePhase(false, true, false, false);
+		timings.update = measurePhase(false, false, true, false);
+		timings.unregistration = measurePhase(false, false, false, true);
+
+		return timings;
+	}
+}
+
+int main()
+{
+	Vector<size_t> order = CreateShuffledOrder();
+
+	Timings legacy = MeasureLegacy(order);
+	Timings handles = MeasureHandles(order, false);
+	Timings named = MeasureHandles(order, true);
+
+	Benchmark::Section("Register (100k objects)");
+	Benchmark::Report("legacy OrderedMap<String>", legacy.registration);
+	Benchmark::Report("GameObjectManager", handles.registration, legacy.registration);
+	Benchmark::Report("GameObjectManager, name indexed", named.registration, legacy.registration);
+
+	Benchmark::Section("Lookup, shuffled (100k objects)");
+	Benchmark::Report("legacy Get(name)", legacy.lookup);
+	Benchmark::Report("GameObjectManager::Get(handle)", handles.lookup, legacy.lookup);
+
+	Benchmark::Section("Update, one thread (100k objects)");
+	Benchmark::Report("legacy OrderedMap<String>", legacy.update);
+	Benchmark::Report("GameObjectManager", handles.update, legacy.update);
+
+	Benchmark::Section("Unregister, shuffled (100k objects)");
+	Benchmark::Report("legacy Unregister(name)", legacy.unregistration);
+	Benchmark::Report("GameObjectManager::Unregister(handle)", handles.unregistration, legacy.unregistration);
+	Benchmark::Report("GameObjectManager, name indexed", named.unregistration, legacy.unregistration);
+
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,217 @@
+#include <array>
+#include <cstdlib>
+#include <functional>
+#include <future>
+#include <memory>
+#include <new>
+#include <queue>
+#include <thread>
+#include "Bench.hpp"
+#include "Thread/ThreadPool.hpp"
+
+using namespace Invasion::Bench;
+using namespace Invasion::Thread;
+
+// Submit latency of ThreadPool against the queue it replaced. Only the submitting loop is timed; the workers drain
+// the batch afterwards. Every global allocation is counted, so the allocation-free paths show 0 allocations per task
+// once the pooled blocks are warm.
+
+namespace
+{
+	std::atomic<uint64_t> allocationCount = 0;
+
+	constexpr size_t WORKER_COUNT = 2;
+	constexpr size_t BATCH_SIZE = 1000;
+	constexpr size_t BATCH_COUNT = 100;
+
+	// The pre-pooling submission path: a shared_ptr holding the task and its promise, wrapped in a std::function and
+	// pushed onto a std::queue.
+	class LegacyThreadPool
+	{
+
+	public:
+
+		LegacyThreadPool(size_t numThreads)
+		{
+			for (size_t i = 0; i < numThreads; ++i)
+			{
+				threads.emplace_back([this]
+				{
+					while (true)
+					{
+						std::function<void()> task;
+
+						{
+							std::unique_lock<std::mutex> lock{ mutex };
+
+							condition.wait(lock, [this] { return stopping || !tasks.empty(); });
+
+							if (stopping && tasks.empty())
+								break;
+
+							task = std::move(tasks.front());
+							tasks.pop();
+						}
+
+						task();
+					}
+				});
+			}
+		}
+
+		~LegacyThreadPool()
+		{
+			{
+				std::unique_lock<std::mutex> lock{ mutex };
+				stopping = true;
+			}
+
+			condition.notify_all();
+
+			for (std::thread& thread : threads)
+				thread.join();
+		}
+
+		template <typename T>
+		auto Submit(T task) -> std::future<decltype(task())>
+		{
+			using Result = decltype(task());
+
+			auto state = std::make_shared<std::packaged_task<Result()>>(std::move(task));
+			std::future<Result> future = state->get_future();
+
+			{
+				std::unique_lock<std::mutex> lock{ mutex };
+				tasks.emplace([state] { (*state)(); });
+			}
+
+			condition.notify_one();
+			return future;
+		}
+
+	private:
+
+		std::vector<std::thread> threads;
+		std::condition_variable condition;
+		std::mutex mutex;
+		bool stopping = false;
+		std::queue<std::function<void()>> tasks;
+
+	};
+
+	template <typename S, typename W>
+	double MeasureSubmit(const char* name, S&& submit, W&& wait, double baseline = 0.0)
+	{
+		uint64_t allocations = 0;
+
+		double result = Benchmark::Measure(BATCH_SIZE * BATCH_COUNT, [&](Stopwatch& stopwatch)
+		{
+			allocations = 0;
+
+			for (size_t batch = 0; batch < BATCH_COUNT; ++batch)
+			{
+				uint64_t before = allocationCount.load(std::memory_order_relaxed);
+
+				stopwatch.Time([&]
+				{
+					for (size_t i = 0; i < BATCH_SIZE; ++i)
+						submit(i);
+				});
+
+				allocations += allocationCount.load(std::memory_order_relaxed) - before;
+
+				wait();
+			}
+		});
+
+		Benchmark::Report(name, result, baseline);
+		std::printf("%-48s %10.2f allocations/op\n", "", static_cast<double>(allocations) / (BATCH_SIZE * BATCH_COUNT));
+
+		return result;
+	}
+}
+
+void* operator new(size_t size)
+{
+	allocationCount.fetch_add(1, std::memory_order_relaxed);
+
+	if (void* block = std::malloc(size != 0 ? size : 1))
+		return block;
+
+	throw std::bad_alloc();
+}
+
+void operator delete(void* block) noexcept
+{
+	std::free(block);
+}
+
+void operator delete(void* block, size_t) noexcept
+{
+	std::free(block);
+}
+
+int main()
+{
+	std::atomic<uint64_t> executed = 0;
+	std::atomic<uint64_t> checksum = 0;
+	std::vector<std::future<void>> futures;
+	futures.reserve(BATCH_SIZE);
+
+	auto task = [&executed] { executed.fetch_add(1, std::memory_order_relaxed); };
+
+	auto waitForFutures = [&futures]
+	{
+		for (std::future<void>& future : futures)
+			future.get();
+
+		futures.clear();
+	};
+
+	Benchmark::Section("Task submission (caller side)");
+
+	double legacy;
+
+	{
+		LegacyThreadPool pool(WORKER_COUNT);
+		legacy = MeasureSubmit("legacy queue, std::function + packaged_task", [&](size_t) { futures.push_back(pool.Submit(task)); }, waitForFutures);
+	}
+
+	{
+		ThreadPool pool(WORKER_COUNT);
+
+		MeasureSubmit("ThreadPool::Submit", [&](size_t) { futures.push_back(pool.Submit(task, TaskPriority::NORMAL)); }, waitForFutures, legacy);
+
+		uint64_t target = executed.load();
+
+		auto waitForExecuted = [&]
+		{
+			while (executed.load(std::memory_order_acquire) < target)
+				std::this_thread::yield();
+		};
+
+		MeasureSubmit("ThreadPool::Dispatch", [&](size_t) { pool.Dispatch(task); ++target; }, waitForExecuted, legacy);
+
+		// Just over the 64-byte inline buffer, so TaskFunction falls back to the heap.
+		std::array<uint64_t, 9> payload = {};
+
+		auto oversized = [&](size_t i)
+		{
+			payload[0] = i;
+
+			pool.Dispatch([&executed, &checksum, payload]
+			{
+				checksum.fetch_add(payload[0], std::memory_order_relaxed);
+				executed.fetch_add(1, std::memory_order_relaxed);
+			});
+
+			++target;
+		};
+
+		MeasureSubmit("ThreadPool::Dispatch, oversized capture", oversized, waitForExecuted, legacy);
+	}
+
+	Benchmark::Consume(executed.load() + checksum.load());
+
+	return 0;
+}
\ No newline at end of file
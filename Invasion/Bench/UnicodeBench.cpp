@@ -0,0 +1,91 @@
+#define _SILENCE_CXX17_CODECVT_HEADER_DEPRECATION_WARNING
+
+#include <codecvt>
+#include <locale>
+#include <string>
+#include <type_traits>
+#include "Bench.hpp"
+#include "Util/Unicode.hpp"
+
+using namespace Invasion::Bench;
+using namespace Invasion::Util;
+
+// Transcoding throughput of Unicode against std::wstring_convert, the converter BasicString used before. Times are
+// per input code unit. The old BasicString built a converter for every call, so that is the baseline; a converter
+// reused across calls is listed as well.
+
+namespace
+{
+	constexpr size_t ITERATION_COUNT = 2000;
+
+	// Windows wchar_t is UTF-16, which is what the old converter produced; elsewhere wchar_t holds UTF-32.
+	using Codecvt = std::conditional_t<sizeof(wchar_t) == 2, std::codecvt_utf8_utf16<wchar_t>, std::codecvt_utf8<wchar_t>>;
+	using Converter = std::wstring_convert<Codecvt, wchar_t>;
+
+	std::string Repeat(const std::string& text, size_t length)
+	{
+		std::string result;
+
+		while (result.length() < length)
+			result += text;
+
+		return result;
+	}
+
+	void MeasureInput(const char* name, const std::string& narrow)
+	{
+		std::wstring wide = Unicode::ToWide(narrow);
+		Converter reused;
+
+		if (reused.from_bytes(narrow) != wide || reused.to_bytes(wide) != narrow)
+		{
+			std::printf("%s: Unicode and wstring_convert disagree\n", name);
+			return;
+		}
+
+		auto measure = [](size_t units, auto&& convert)
+		{
+			return Benchmark::Measure(units * ITERATION_COUNT, [&](Stopwatch& stopwatch)
+			{
+				stopwatch.Time([&]
+				{
+					for (size_t i = 0; i < ITERATION_COUNT; ++i)
+						Benchmark::Consume(convert().length());
+				});
+			});
+		};
+
+		std::string title = std::string(name) + ", " + std::to_string(narrow.length()) + " bytes";
+		Benchmark::Section(title.c_str());
+
+		double perCall = measure(narrow.length(), [&] { return Converter().from_bytes(narrow); });
+		double shared = measure(narrow.length(), [&] { return reused.from_bytes(narrow); });
+		double fast = measure(narrow.length(), [&] { return Unicode::ToWide(narrow); });
+
+		Benchmark::Report("UTF-8 -> wide, wstring_convert per call", perCall);
+		Benchmark::Report("UTF-8 -> wide, wstring_convert reused", shared, perCall);
+		Benchmark::Report("UTF-8 -> wide, Unicode::ToWide", fast, perCall);
+
+		perCall = measure(wide.length(), [&] { return Converter().to_bytes(wide); });
+		shared = measure(wide.length(), [&] { return reused.to_bytes(wide); });
+		fast = measure(wide.length(), [&] { return Unicode::ToNarrow(wide); });
+
+		Benchmark::Report("wide -> UTF-8, wstring_convert per call", perCall);
+		Benchmark::Report("wide -> UTF-8, wstring_convert reused", shared, perCall);
+		Benchmark::Report("wide -> UTF-8, Unicode::ToNarrow", fast, perCall);
+	}
+}
+
+int main()
+{
+	std::string path = "Assets/Invasion/Texture/Block/dirt.dds";
+	std::string ascii = Repeat("The quick brown fox jumps over the lazy dog. ", 4096);
+	// Latin-1, CJK and an astral-plane emoji, written as escapes so the source stays ASCII.
+	std::string mixed = Repeat("Gr\xC3\xBC\xC3\x9F" "e, \xE4\xB8\x96\xE7\x95\x8C! \xC3\x87" "a va? Invasion \xF0\x9F\x8E\xAE ", 4096);
+
+	MeasureInput("Asset path", path);
+	MeasureInput("ASCII text", ascii);
+	MeasureInput("Mixed text", mixed);
+
+	return 0;
+}
\ No newline at end of file
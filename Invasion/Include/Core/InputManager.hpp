@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cassert>
+#include <thread>
 #include <Windows.h>
 #include "Core/Window.hpp"
 #include "Math/Vector2.hpp"
@@ -261,8 +263,10 @@ namespace Invasion::Core
 
         void Update()
         {
-            Vector<KeyCode> keysToRemove;
-            Vector<MouseCode> buttonsToRemove;
+            assert(IsOwnerThread() && "InputManager is only written on the main thread");
+
+            SmallVector<KeyCode, 16> keysToRemove;
+            SmallVector<MouseCode, 8> buttonsToRemove;
 
             for (auto& [key, state] : keyStates)
             {
@@ -323,16 +327,22 @@ namespace Invasion::Core
 
         void SetMousePosition(const Vector2i& position)
         {
+            assert(IsOwnerThread() && "InputManager is only written on the main thread");
+
             mousePosition = Vector2i{ position.x, position.y };
         }
 
         void SetKeyState(KeyCode key, KeyState state)
         {
+            assert(IsOwnerThread() && "InputManager is only written on the main thread");
+
             keyStates[key] = state;
         }
 
         void SetMouseButtonState(MouseCode button, MouseState state)
         {
+            assert(IsOwnerThread() && "InputManager is only written on the main thread");
+
             mouseButtonStates[button] = state;
         }
 
@@ -358,6 +368,8 @@ namespace Invasion::Core
 
         void SetCursorState(CursorState state)
         {
+            assert(IsOwnerThread() && "InputManager is only written on the main thread");
+
             cursorState = state;
 
             if (state == CursorState::LOCKED)
@@ -380,6 +392,13 @@ namespace Invasion::Core
 
     private:
 
+        // The maps use NoLock. Writes come from the window procedure and InputSystem, both on the main thread while no
+        // system is running, so components may read input from pool workers during SystemScheduler::Update.
+        bool IsOwnerThread() const
+        {
+            return std::this_thread::get_id() == owner;
+        }
+
         InputManager()
         {
             mousePosition = Vector2i{ 0, 0 };
@@ -392,12 +411,14 @@ namespace Invasion::Core
             mousePosition = Vector2i{ position.x, position.y };
         }
 
-        UnorderedMap<KeyCode, KeyState> keyStates;
-        UnorderedMap<MouseCode, MouseState> mouseButtonStates;
+        UnorderedMap<KeyCode, KeyState, NoLock> keyStates;
+        UnorderedMap<MouseCode, MouseState, NoLock> mouseButtonStates;
 
         Vector2i mousePosition;
         Vector2i mouseDelta;
 
         CursorState cursorState = CursorState::UNLOCKED;
+
+        std::thread::id owner = std::this_thread::get_id();
     };
 }
\ No newline at end of file
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "Core/InputManager.hpp"
+#include "ECS/System.hpp"
+
+using namespace Invasion::ECS;
+
+namespace Invasion::Core
+{
+    class InputSystem : public System
+    {
+
+    public:
+
+        void Update(ThreadPool& threadPool) override
+        {
+            InputManager::GetInstance().Update();
+        }
+
+        static Shared<InputSystem> Create()
+        {
+            class Enabled : public InputSystem { };
+
+            return std::make_shared<Enabled>();
+        }
+
+    protected:
+
+        // Exclusive systems run inline on the thread driving the scheduler, so input is rolled over on the main thread
+        // before any other system starts and stays read-only while they run.
+        InputSystem() : System("Input")
+        {
+            Exclusive();
+        }
+
+    };
+}
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Util/StringId.hpp"
 #include "Util/Typedefs.hpp"
 
 using namespace Invasion::Util;
@@ -15,19 +16,19 @@ namespace Invasion::Core
 		void operator=(const Settings&) = delete;
 
 		template <typename T>
-		void Set(const String& key, const T& value)
+		void Set(StringId key, const T& value)
 		{
 			settings[key] = std::make_any<T>(value);
 		}
 
 		template <typename T>
-		T Get(const String& key)
+		T Get(StringId key)
 		{
 			return std::any_cast<T>(settings[key]);
 		}
 
 		template <typename T>
-		T Get(const String& key, const T& defaultValue)
+		T Get(StringId key, const T& defaultValue)
 		{
 			if (!settings.Contains(key))
 				return defaultValue;
@@ -36,13 +37,13 @@ namespace Invasion::Core
 		}
 
 		template <typename T>
-		bool Contains(const String& key)
+		bool Contains(StringId key)
 		{
 			return settings.Contains(key);
 		}
 
 		template <typename T>
-		void Remove(const String& key)
+		void Remove(StringId key)
 		{
 			settings -= key;
 		}
@@ -58,7 +59,7 @@ namespace Invasion::Core
 
 		Settings() = default;
 
-		OrderedMap<String, Any> settings;
+		FlatMap<StringId, Any> settings;
 
 	};
 }
\ No newline at end of file
@@ -0,0 +1,321 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <new>
+#include <utility>
+#include "ECS/ComponentType.hpp"
+#include "Util/Typedefs.hpp"
+
+using namespace Invasion::Util;
+
+namespace Invasion::ECS
+{
+    struct Entity
+    {
+        uint32_t index = INVALID_INDEX;
+        uint32_t generation = 0;
+
+        bool IsValid() const
+        {
+            return index != INVALID_INDEX;
+        }
+
+        bool operator==(const Entity& other) const
+        {
+            return index == other.index && generation == other.generation;
+        }
+
+        bool operator!=(const Entity& other) const
+        {
+            return !(*this == other);
+        }
+
+        static constexpr uint32_t INVALID_INDEX = 0xFFFFFFFF;
+    };
+
+    struct ComponentTypeInformation
+    {
+        size_t id;
+        TypeIndex type;
+        size_t size;
+        size_t alignment;
+        void (*moveConstruct)(void*, void*);
+        void (*destroy)(void*);
+
+        template <typename T>
+        static const ComponentTypeInformation* Get()
+        {
+            static const ComponentTypeInformation information
+            {
+                ComponentType::GetId<T>(),
+                typeid(T),
+                sizeof(T),
+                alignof(T),
+                [](void* destination, void* source) { new (destination) T(std::move(*static_cast<T*>(source))); },
+                [](void* pointer) { static_cast<T*>(pointer)->~T(); }
+            };
+
+            return &information;
+        }
+    };
+
+    class ArchetypeChunk
+    {
+
+    public:
+
+        ArchetypeChunk() = default;
+
+        ArchetypeChunk(const ArchetypeChunk&) = delete;
+        ArchetypeChunk& operator=(const ArchetypeChunk&) = delete;
+
+        ArchetypeChunk(ArchetypeChunk&& other) noexcept : memory(std::exchange(other.memory, nullptr)), length(std::exchange(other.length, 0)) { }
+
+        ArchetypeChunk& operator=(ArchetypeChunk&& other) noexcept
+        {
+            if (this != &other)
+            {
+                Release();
+                memory = std::exchange(other.memory, nullptr);
+                length = std::exchange(other.length, 0);
+            }
+
+            return *this;
+        }
+
+        ~ArchetypeChunk()
+        {
+            Release();
+        }
+
+        static ArchetypeChunk Allocate()
+        {
+            ArchetypeChunk result;
+
+            result.memory = static_cast<byte*>(::operator new(SIZE, std::align_val_t{ ALIGNMENT }));
+            MemoryTracker::RecordAllocation(MemoryTag::ECS, SIZE);
+
+            return result;
+        }
+
+        byte* GetMemory() const
+        {
+            return memory;
+        }
+
+        static constexpr size_t SIZE = 16 * 1024;
+        static constexpr size_t ALIGNMENT = 64;
+
+    private:
+
+        friend class Archetype;
+
+        void Release()
+        {
+            if (memory)
+            {
+                ::operator delete(memory, std::align_val_t{ ALIGNMENT });
+                MemoryTracker::RecordDeallocation(MemoryTag::ECS, SIZE);
+                memory = nullptr;
+            }
+        }
+
+        byte* memory = nullptr;
+        size_t length = 0;
+
+    };
+
+    class Archetype
+    {
+
+    public:
+
+        struct Location
+        {
+            size_t chunk = 0;
+            size_t row = 0;
+        };
+
+        Archetype(const Archetype&) = delete;
+        Archetype& operator=(const Archetype&) = delete;
+
+        explicit Archetype(const Vector<const ComponentTypeInformation*>& types) : types(types)
+        {
+            std::sort(this->types.begin(), this->types.end(), [](const ComponentTypeInformation* a, const ComponentTypeInformation* b) { return a->id < b->id; });
+
+            size_t rowSize = sizeof(Entity);
+
+            for (const ComponentTypeInformation* information : this->types)
+                rowSize += information->size;
+
+            capacity = std::max<size_t>(1, ArchetypeChunk::SIZE / rowSize);
+
+            while (capacity > 1 && ComputeLayout(capacity) > ArchetypeChunk::SIZE)
+                --capacity;
+
+            ComputeLayout(capacity);
+        }
+
+        ~Archetype()
+        {
+            for (size_t chunk = 0; chunk < chunks.Length(); ++chunk)
+            {
+                for (size_t row = 0; row < chunks[chunk].length; ++row)
+                    DestroyRow({ chunk, row });
+            }
+        }
+
+        const Vector<const ComponentTypeInformation*>& GetTypes() const
+        {
+            return types;
+        }
+
+        size_t GetColumn(size_t id) const
+        {
+            for (size_t column = 0; column < types.Length() && types[column]->id <= id; ++column)
+            {
+                if (types[column]->id == id)
+                    return column;
+            }
+
+            return NullColumn;
+        }
+
+        bool Contains(size_t id) const
+        {
+            return GetColumn(id) != NullColumn;
+        }
+
+        bool Matches(const Vector<const ComponentTypeInformation*>& other) const
+        {
+            if (other.Length() != types.Length())
+                return false;
+
+            for (const ComponentTypeInformation* information : other)
+            {
+                if (!Contains(information->id))
+                    return false;
+            }
+
+            return true;
+        }
+
+        Location Allocate(Entity entity)
+        {
+            if (chunks.IsEmpty() || chunks.Back().length == capacity)
+                chunks |= ArchetypeChunk::Allocate();
+
+            Location location{ chunks.Length() - 1, chunks.Back().length++ };
+
+            GetEntities(location.chunk)[location.row] = entity;
+            ++entityCount;
+
+            return location;
+        }
+
+        Entity Remove(const Location& location)
+        {
+            DestroyRow(location);
+
+            ArchetypeChunk& last = chunks.Back();
+            Location lastLocation{ chunks.Length() - 1, last.length - 1 };
+            Entity moved;
+
+            if (lastLocation.chunk != location.chunk || lastLocation.row != location.row)
+            {
+                for (size_t column = 0; column < types.Length(); ++column)
+                {
+                    types[column]->moveConstruct(GetComponent(column, location), GetComponent(column, lastLocation));
+                    types[column]->destroy(GetComponent(column, lastLocation));
+                }
+
+                moved = GetEntities(lastLocation.chunk)[lastLocation.row];
+                GetEntities(location.chunk)[location.row] = moved;
+            }
+
+            --last.length;
+            --entityCount;
+
+            if (last.length == 0)
+                chunks.Resize(chunks.Length() - 1);
+
+            return moved;
+        }
+
+        void* GetComponent(size_t column, const Location& location) const
+        {
+            return chunks[location.chunk].memory + columnOffsets[column] + location.row * types[column]->size;
+        }
+
+        template <typename T>
+        T* GetColumnData(size_t column, size_t chunk) const
+        {
+            return reinterpret_cast<T*>(chunks[chunk].memory + columnOffsets[column]);
+        }
+
+        Entity* GetEntities(size_t chunk) const
+        {
+            return reinterpret_cast<Entity*>(chunks[chunk].memory);
+        }
+
+        size_t GetChunkCount() const
+        {
+            return chunks.Length();
+        }
+
+        size_t GetChunkLength(size_t chunk) const
+        {
+            return chunks[chunk].length;
+        }
+
+        size_t GetChunkCapacity() const
+        {
+            return capacity;
+        }
+
+        size_t Length() const
+        {
+            return entityCount;
+        }
+
+        static constexpr size_t NullColumn = static_cast<size_t>(-1);
+
+    private:
+
+        friend class EntityManager;
+
+        size_t ComputeLayout(size_t rows)
+        {
+            size_t offset = sizeof(Entity) * rows;
+
+            columnOffsets.Clear();
+
+            for (const ComponentTypeInformation* information : types)
+            {
+                offset = (offset + information->alignment - 1) / information->alignment * information->alignment;
+                columnOffsets += offset;
+                offset += information->size * rows;
+            }
+
+            return offset;
+        }
+
+        void DestroyRow(const Location& location)
+        {
+            for (size_t column = 0; column < types.Length(); ++column)
+                types[column]->destroy(GetComponent(column, location));
+        }
+
+        Vector<const ComponentTypeInformation*> types;
+        Vector<size_t> columnOffsets;
+        Vector<ArchetypeChunk> chunks;
+
+        size_t capacity = 0;
+        size_t entityCount = 0;
+
+        FlatMap<size_t, Archetype*, NoLock> addEdges;
+        FlatMap<size_t, Archetype*, NoLock> removeEdges;
+
+    };
+}
\ No newline at end of file
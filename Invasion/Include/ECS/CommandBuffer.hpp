@@ -0,0 +1,158 @@
+#pragma once
+
+#include <algorithm>
+#include "ECS/EntityManager.hpp"
+#include "ECS/GameObjectManager.hpp"
+#include "Thread/TaskFunction.hpp"
+#include "Util/Typedefs.hpp"
+
+using namespace Invasion::Thread;
+using namespace Invasion::Util;
+
+namespace Invasion::ECS
+{
+    class CommandBuffer
+    {
+
+    public:
+
+        CommandBuffer(const CommandBuffer&) = delete;
+        CommandBuffer& operator=(const CommandBuffer&) = delete;
+
+        void CreateEntity(Shared<GameObject> gameObject)
+        {
+            Record([gameObject = std::move(gameObject)] { gameObject->CreateEntity(); });
+        }
+
+        void Register(Shared<GameObject> gameObject, bool indexName = true)
+        {
+            Record([gameObject = std::move(gameObject), indexName] { GameObjectManager::GetInstance().Register(gameObject, indexName); });
+        }
+
+        void Unregister(Shared<GameObject> gameObject)
+        {
+            Record([gameObject = std::move(gameObject)] { GameObjectManager::GetInstance().Unregister(gameObject->GetHandle()); });
+        }
+
+        template <typename T>
+        void AddComponent(Shared<GameObject> gameObject, Shared<T> component)
+        {
+            Record([gameObject = std::move(gameObject), component = std::move(component)] { gameObject->AddComponent(component); });
+        }
+
+        template <typename T>
+        void RemoveComponent(Shared<GameObject> gameObject)
+        {
+            Record([gameObject = std::move(gameObject)] { gameObject->RemoveComponent<T>(); });
+        }
+
+        template <typename T>
+        void Add(Entity entity, T value)
+        {
+            Record([entity, value = std::move(value)]() mutable { EntityManager::GetInstance().Add(entity, std::move(value)); });
+        }
+
+        template <typename T>
+        void Remove(Entity entity)
+        {
+            Record([entity] { EntityManager::GetInstance().Remove<T>(entity); });
+        }
+
+        void Destroy(Entity entity)
+        {
+            Record([entity] { EntityManager::GetInstance().Destroy(entity); });
+        }
+
+        size_t Length()
+        {
+            LockGuard<Mutex> lock(mutex);
+            return commands.Length();
+        }
+
+        static CommandBuffer& GetLocal()
+        {
+            thread_local Shared<CommandBuffer> local = Create();
+            return *local;
+        }
+
+        static void FlushAll()
+        {
+            LockGuard<Mutex> flushLock(flushMutex);
+
+            Vector<Command> flushing;
+
+            {
+                LockGuard<Mutex> lock(registryMutex);
+
+                for (Shared<CommandBuffer>& buffer : buffers)
+                {
+                    LockGuard<Mutex> bufferLock(buffer->mutex);
+
+                    for (Command& command : buffer->commands)
+                        flushing |= std::move(command);
+
+                    buffer->commands.Clear();
+                }
+            }
+
+            std::sort(flushing.begin(), flushing.end(), [](const Command& a, const Command& b) { return a.sequence < b.sequence; });
+
+            std::exception_ptr exception;
+
+            for (Command& command : flushing)
+            {
+                try
+                {
+                    command.function();
+                }
+                catch (...)
+                {
+                    if (!exception)
+                        exception = std::current_exception();
+                }
+            }
+
+            if (exception)
+                std::rethrow_exception(exception);
+        }
+
+    private:
+
+        struct Command
+        {
+            uint64_t sequence;
+            TaskFunction function;
+        };
+
+        CommandBuffer() = default;
+
+        template <typename F>
+        void Record(F&& function)
+        {
+            uint64_t sequence = nextSequence.fetch_add(1, std::memory_order_relaxed);
+
+            LockGuard<Mutex> lock(mutex);
+            commands |= Command{ sequence, TaskFunction{ std::forward<F>(function) } };
+        }
+
+        static Shared<CommandBuffer> Create()
+        {
+            class Enabled : public CommandBuffer { };
+            Shared<CommandBuffer> result = std::make_shared<Enabled>();
+
+            LockGuard<Mutex> lock(registryMutex);
+            buffers += result;
+
+            return result;
+        }
+
+        Mutex mutex;
+        Vector<Command> commands;
+
+        static inline Atomic<uint64_t> nextSequence = 0;
+        static inline Mutex registryMutex;
+        static inline Mutex flushMutex;
+        static inline Vector<Shared<CommandBuffer>> buffers;
+
+    };
+}
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "ECS/Archetype.hpp"
 #include "Util/Typedefs.hpp"
 
 using namespace Invasion::Util;
@@ -25,6 +26,14 @@ namespace Invasion::ECS
 
 		virtual void CleanUp() { }
 
+		// Called when the component's ComponentReference column is added to or removed from the GameObject's entity, so
+		// components can keep hot data in by-value columns. Runs under the GameObject's lock.
+		virtual void OnAttach(Entity entity) { }
+		virtual void OnDetach(Entity entity) { }
+
+		// Called after another component is added to or removed from the same GameObject, without its lock held.
+		virtual void OnComponentsChanged() { }
+
 		Shared<GameObject> GetGameObject() const { return gameObject; }
 
 	private:
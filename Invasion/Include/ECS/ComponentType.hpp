@@ -0,0 +1,48 @@
+#pragma once
+
+#include "Util/Typedefs.hpp"
+
+using namespace Invasion::Util;
+
+namespace Invasion::ECS
+{
+    class ComponentType
+    {
+
+    public:
+
+        ComponentType() = delete;
+
+        template <typename T>
+        static size_t GetId()
+        {
+            static const size_t id = nextId.fetch_add(1, std::memory_order_relaxed);
+            return id;
+        }
+
+        static size_t GetCount()
+        {
+            return nextId.load(std::memory_order_relaxed);
+        }
+
+        // GameObject slot indices live in their own dense range so archetype column types such as
+        // ComponentReference<T> never consume entries in the fixed-size slot table.
+        template <typename T>
+        static size_t GetSlot()
+        {
+            static const size_t slot = nextSlot.fetch_add(1, std::memory_order_relaxed);
+            return slot;
+        }
+
+        static size_t GetSlotCount()
+        {
+            return nextSlot.load(std::memory_order_relaxed);
+        }
+
+    private:
+
+        static inline Atomic<size_t> nextId = 0;
+        static inline Atomic<size_t> nextSlot = 0;
+
+    };
+}
\ No newline at end of file
@@ -0,0 +1,172 @@
+#pragma once
+
+#include "ECS/Archetype.hpp"
+#include "Thread/ThreadPool.hpp"
+#include "Util/Typedefs.hpp"
+
+using namespace Invasion::Thread;
+using namespace Invasion::Util;
+
+namespace Invasion::ECS
+{
+    struct Query
+    {
+        Vector<size_t> ids;
+        Vector<Archetype*> archetypes;
+        Vector<size_t> columns;
+
+        bool TryAdd(Archetype* archetype)
+        {
+            size_t start = columns.Length();
+
+            for (size_t id : ids)
+            {
+                size_t column = archetype->GetColumn(id);
+
+                if (column == Archetype::NullColumn)
+                {
+                    columns.Resize(start);
+                    return false;
+                }
+
+                columns += column;
+            }
+
+            archetypes += archetype;
+
+            return true;
+        }
+    };
+
+    // Marks the current thread as running a view callback. Views hold the EntityManager's shared lock for the whole
+    // iteration, so a callback that changes structure, or takes the lock again while a writer is queued, deadlocks.
+    // EntityManager asserts against both; record structural changes through CommandBuffer instead.
+    class ViewIteration
+    {
+
+    public:
+
+        ViewIteration()
+        {
+            ++depth;
+        }
+
+        ~ViewIteration()
+        {
+            --depth;
+        }
+
+        ViewIteration(const ViewIteration&) = delete;
+        ViewIteration& operator=(const ViewIteration&) = delete;
+
+        static bool IsActive()
+        {
+            return depth != 0;
+        }
+
+    private:
+
+        static inline thread_local size_t depth = 0;
+
+    };
+
+    template <typename... Ts>
+    class ComponentView
+    {
+
+    public:
+
+        ComponentView(SharedMutex& mutex, const Query& query) : mutex(&mutex), query(&query) { }
+
+        template <typename F>
+        void ForEachChunk(F&& function) const
+        {
+            assert(!ViewIteration::IsActive() && "Views cannot be nested inside another view's callback");
+
+            SharedLock<SharedMutex> lock(*mutex);
+            ViewIteration iteration;
+
+            for (size_t match = 0; match < query->archetypes.Length(); ++match)
+            {
+                Archetype& archetype = *query->archetypes[match];
+
+                for (size_t chunk = 0; chunk < archetype.GetChunkCount(); ++chunk)
+                    InvokeChunk(archetype, chunk, &query->columns[match * sizeof...(Ts)], function, std::index_sequence_for<Ts...>{});
+            }
+        }
+
+        template <typename F>
+        void ForEach(F&& function) const
+        {
+            ForEachChunk([&function](size_t count, Entity* entities, Ts*... columns)
+            {
+                for (size_t i = 0; i < count; ++i)
+                    function(entities[i], columns[i]...);
+            });
+        }
+
+        // Callbacks run on pool workers while the calling thread holds the shared lock; they must not change
+        // structure or use the EntityManager directly (see ViewIteration).
+        template <typename F>
+        void ParallelForEach(ThreadPool& threadPool, F&& function) const
+        {
+            assert(!ViewIteration::IsActive() && "Views cannot be nested inside another view's callback");
+
+            SharedLock<SharedMutex> lock(*mutex);
+
+            Vector<Pair<size_t, size_t>> chunks;
+
+            for (size_t match = 0; match < query->archetypes.Length(); ++match)
+            {
+                for (size_t chunk = 0; chunk < query->archetypes[match]->GetChunkCount(); ++chunk)
+                    chunks += Pair<size_t, size_t>(match, chunk);
+            }
+
+            threadPool.ParallelFor(0, chunks.Length(), [this, &chunks, &function](size_t index)
+            {
+                auto [match, chunk] = chunks[index];
+                ViewIteration iteration;
+
+                InvokeChunk(*query->archetypes[match], chunk, &query->columns[match * sizeof...(Ts)], [&function](size_t count, Entity* entities, Ts*... columns)
+                {
+                    for (size_t i = 0; i < count; ++i)
+                        function(entities[i], columns[i]...);
+                }, std::index_sequence_for<Ts...>{});
+            }, 1);
+        }
+
+        size_t Length() const
+        {
+            assert(!ViewIteration::IsActive() && "Views cannot be queried inside a view callback");
+
+            SharedLock<SharedMutex> lock(*mutex);
+
+            size_t result = 0;
+
+            for (Archetype* archetype : query->archetypes)
+                result += archetype->Length();
+
+            return result;
+        }
+
+        size_t GetArchetypeCount() const
+        {
+            assert(!ViewIteration::IsActive() && "Views cannot be queried inside a view callback");
+
+            SharedLock<SharedMutex> lock(*mutex);
+            return query->archetypes.Length();
+        }
+
+    private:
+
+        template <typename F, size_t... Indices>
+        static void InvokeChunk(Archetype& archetype, size_t chunk, const size_t* columns, F&& function, std::index_sequence<Indices...>)
+        {
+            function(archetype.GetChunkLength(chunk), archetype.GetEntities(chunk), archetype.GetColumnData<Ts>(columns[Indices], chunk)...);
+        }
+
+        SharedMutex* mutex;
+        const Query* query;
+
+    };
+}
\ No newline at end of file
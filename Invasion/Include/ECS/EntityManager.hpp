@@ -0,0 +1,374 @@
+#pragma once
+
+#include "ECS/Archetype.hpp"
+#include "ECS/ComponentView.hpp"
+#include "Thread/ThreadPool.hpp"
+#include "Util/Typedefs.hpp"
+
+using namespace Invasion::Thread;
+using namespace Invasion::Util;
+
+namespace Invasion::ECS
+{
+    template <typename T>
+    struct ComponentReference
+    {
+        T* component = nullptr;
+    };
+
+    class EntityManager
+    {
+
+    public:
+
+        EntityManager(const EntityManager&) = delete;
+        EntityManager& operator=(const EntityManager&) = delete;
+
+        Entity Create()
+        {
+            assert(!ViewIteration::IsActive() && "Structural changes inside a view callback deadlock; record them through CommandBuffer");
+
+            LockGuard<SharedMutex> lock(mutex);
+
+            Entity entity;
+
+            if (!freeIndices.IsEmpty())
+            {
+                entity.index = freeIndices.Back();
+                freeIndices.Resize(freeIndices.Length() - 1);
+            }
+            else
+            {
+                entity.index = static_cast<uint32_t>(records.Length());
+                records += EntityRecord{};
+            }
+
+            EntityRecord& record = records[entity.index];
+
+            entity.generation = record.generation;
+            record.archetype = GetEmptyArchetype();
+            record.location = record.archetype->Allocate(entity);
+
+            return entity;
+        }
+
+        void Destroy(Entity entity)
+        {
+            assert(!ViewIteration::IsActive() && "Structural changes inside a view callback deadlock; record them through CommandBuffer");
+
+            LockGuard<SharedMutex> lock(mutex);
+
+            if (!IsAliveUnlocked(entity))
+                return;
+
+            EntityRecord& record = records[entity.index];
+
+            RemoveRow(record.archetype, record.location);
+
+            record.archetype = nullptr;
+            ++record.generation;
+
+            freeIndices += entity.index;
+        }
+
+        bool IsAlive(Entity entity) const
+        {
+            assert(!ViewIteration::IsActive() && "The EntityManager cannot be used inside a view callback; its shared lock is already held");
+
+            SharedLock<SharedMutex> lock(mutex);
+            return IsAliveUnlocked(entity);
+        }
+
+        // Adding a component the entity already has replaces the stored value in place; the entity keeps its archetype.
+        template <typename T>
+        T& Add(Entity entity, T value = T{})
+        {
+            assert(!ViewIteration::IsActive() && "Structural changes inside a view callback deadlock; record them through CommandBuffer");
+
+            LockGuard<SharedMutex> lock(mutex);
+
+            assert(IsAliveUnlocked(entity) && "Entity is not alive");
+
+            EntityRecord& record = records[entity.index];
+            size_t column = record.archetype->GetColumn(ComponentType::GetId<T>());
+
+            if (column == Archetype::NullColumn)
+            {
+                Archetype* target = GetArchetypeWith(record.archetype, ComponentTypeInformation::Get<T>());
+
+                MoveEntity(entity, target);
+                column = target->GetColumn(ComponentType::GetId<T>());
+
+                T* result = static_cast<T*>(target->GetComponent(column, record.location));
+                new (result) T(std::move(value));
+
+                return *result;
+            }
+
+            T* result = static_cast<T*>(record.archetype->GetComponent(column, record.location));
+            *result = std::move(value);
+
+            return *result;
+        }
+
+        template <typename T>
+        void Remove(Entity entity)
+        {
+            assert(!ViewIteration::IsActive() && "Structural changes inside a view callback deadlock; record them through CommandBuffer");
+
+            LockGuard<SharedMutex> lock(mutex);
+
+            if (!IsAliveUnlocked(entity))
+                return;
+
+            EntityRecord& record = records[entity.index];
+
+            if (!record.archetype->Contains(ComponentType::GetId<T>()))
+                return;
+
+            MoveEntity(entity, GetArchetypeWithout(record.archetype, ComponentType::GetId<T>()));
+        }
+
+        template <typename T>
+        T* Get(Entity entity)
+        {
+            assert(!ViewIteration::IsActive() && "The EntityManager cannot be used inside a view callback; its shared lock is already held");
+
+            SharedLock<SharedMutex> lock(mutex);
+
+            if (!IsAliveUnlocked(entity))
+                return nullptr;
+
+            EntityRecord& record = records[entity.index];
+            size_t column = record.archetype->GetColumn(ComponentType::GetId<T>());
+
+            if (column == Archetype::NullColumn)
+                return nullptr;
+
+            return static_cast<T*>(record.archetype->GetComponent(column, record.location));
+        }
+
+        // Calls function(i, component) for the T of each live entity in entities under a single shared lock, for systems
+        // that write back many rows at once. Entities that are dead or have no T are skipped.
+        template <typename T, typename F>
+        void ForEachOf(const Entity* entities, size_t count, F&& function)
+        {
+            assert(!ViewIteration::IsActive() && "The EntityManager cannot be used inside a view callback; its shared lock is already held");
+
+            SharedLock<SharedMutex> lock(mutex);
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (!IsAliveUnlocked(entities[i]))
+                    continue;
+
+                EntityRecord& record = records[entities[i].index];
+                size_t column = record.archetype->GetColumn(ComponentType::GetId<T>());
+
+                if (column != Archetype::NullColumn)
+                    function(i, *static_cast<T*>(record.archetype->GetComponent(column, record.location)));
+            }
+        }
+
+        template <typename T>
+        bool Has(Entity entity) const
+        {
+            assert(!ViewIteration::IsActive() && "The EntityManager cannot be used inside a view callback; its shared lock is already held");
+
+            SharedLock<SharedMutex> lock(mutex);
+            return IsAliveUnlocked(entity) && records[entity.index].archetype->Contains(ComponentType::GetId<T>());
+        }
+
+        template <typename... Ts>
+        ComponentView<Ts...> View()
+        {
+            static const Query* query = CreateQuery({ ComponentType::GetId<Ts>()... });
+
+            return ComponentView<Ts...>(mutex, *query);
+        }
+
+        template <typename... Ts, typename F>
+        void ForEachChunk(F&& function)
+        {
+            View<Ts...>().ForEachChunk(std::forward<F>(function));
+        }
+
+        template <typename... Ts, typename F>
+        void ForEach(F&& function)
+        {
+            View<Ts...>().ForEach(std::forward<F>(function));
+        }
+
+        template <typename... Ts, typename F>
+        void ParallelForEach(ThreadPool& threadPool, F&& function)
+        {
+            View<Ts...>().ParallelForEach(threadPool, std::forward<F>(function));
+        }
+
+        size_t GetEntityCount() const
+        {
+            assert(!ViewIteration::IsActive() && "The EntityManager cannot be used inside a view callback; its shared lock is already held");
+
+            SharedLock<SharedMutex> lock(mutex);
+            return records.Length() - freeIndices.Length();
+        }
+
+        size_t GetArchetypeCount() const
+        {
+            assert(!ViewIteration::IsActive() && "The EntityManager cannot be used inside a view callback; its shared lock is already held");
+
+            SharedLock<SharedMutex> lock(mutex);
+            return archetypes.Length();
+        }
+
+        static EntityManager& GetInstance()
+        {
+            static EntityManager instance;
+            return instance;
+        }
+
+    private:
+
+        struct EntityRecord
+        {
+            Archetype* archetype = nullptr;
+            Archetype::Location location;
+            uint32_t generation = 0;
+        };
+
+        EntityManager() = default;
+
+        const Query* CreateQuery(const Vector<size_t>& ids)
+        {
+            LockGuard<Mutex> lock(queryMutex);
+
+            for (Unique<Query>& query : queries)
+            {
+                if (query->ids == ids)
+                    return query.get();
+            }
+
+            queries |= std::make_unique<Query>();
+
+            Query* query = queries.Back().get();
+            query->ids = ids;
+
+            for (Unique<Archetype>& archetype : archetypes)
+                query->TryAdd(archetype.get());
+
+            return query;
+        }
+
+        bool IsAliveUnlocked(Entity entity) const
+        {
+            return entity.index < records.Length() && records[entity.index].archetype != nullptr && records[entity.index].generation == entity.generation;
+        }
+
+        Archetype* GetEmptyArchetype()
+        {
+            if (!emptyArchetype)
+                emptyArchetype = FindOrCreateArchetype({});
+
+            return emptyArchetype;
+        }
+
+        Archetype* FindOrCreateArchetype(const Vector<const ComponentTypeInformation*>& types)
+        {
+            for (Unique<Archetype>& archetype : archetypes)
+            {
+                if (archetype->Matches(types))
+                    return archetype.get();
+            }
+
+            LockGuard<Mutex> lock(queryMutex);
+
+            archetypes |= std::make_unique<Archetype>(types);
+
+            for (Unique<Query>& query : queries)
+                query->TryAdd(archetypes.Back().get());
+
+            return archetypes.Back().get();
+        }
+
+        Archetype* GetArchetypeWith(Archetype* source, const ComponentTypeInformation* information)
+        {
+            Archetype* target = nullptr;
+
+            if (source->addEdges.Find(information->id, target))
+                return target;
+
+            Vector<const ComponentTypeInformation*> types = source->GetTypes();
+            types += information;
+
+            target = FindOrCreateArchetype(types);
+
+            source->addEdges += { information->id, target };
+            target->removeEdges += { information->id, source };
+
+            return target;
+        }
+
+        Archetype* GetArchetypeWithout(Archetype* source, size_t id)
+        {
+            Archetype* target = nullptr;
+
+            if (source->removeEdges.Find(id, target))
+                return target;
+
+            Vector<const ComponentTypeInformation*> types;
+
+            for (const ComponentTypeInformation* information : source->GetTypes())
+            {
+                if (information->id != id)
+                    types += information;
+            }
+
+            target = FindOrCreateArchetype(types);
+
+            source->removeEdges += { id, target };
+            target->addEdges += { id, source };
+
+            return target;
+        }
+
+        void MoveEntity(Entity entity, Archetype* target)
+        {
+            EntityRecord& record = records[entity.index];
+            Archetype* source = record.archetype;
+            Archetype::Location sourceLocation = record.location;
+            Archetype::Location targetLocation = target->Allocate(entity);
+
+            for (size_t column = 0; column < source->GetTypes().Length(); ++column)
+            {
+                size_t targetColumn = target->GetColumn(source->GetTypes()[column]->id);
+
+                if (targetColumn != Archetype::NullColumn)
+                    source->GetTypes()[column]->moveConstruct(target->GetComponent(targetColumn, targetLocation), source->GetComponent(column, sourceLocation));
+            }
+
+            RemoveRow(source, sourceLocation);
+
+            record.archetype = target;
+            record.location = targetLocation;
+        }
+
+        void RemoveRow(Archetype* archetype, const Archetype::Location& location)
+        {
+            Entity moved = archetype->Remove(location);
+
+            if (moved.IsValid())
+                records[moved.index].location = location;
+        }
+
+        mutable SharedMutex mutex;
+
+        Vector<EntityRecord> records;
+        Vector<uint32_t> freeIndices;
+        Vector<Unique<Archetype>> archetypes;
+        Archetype* emptyArchetype = nullptr;
+
+        Mutex queryMutex;
+        Vector<Unique<Query>> queries;
+
+    };
+}
\ No newline at end of file
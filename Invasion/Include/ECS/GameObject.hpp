@@ -1,8 +1,16 @@
 #pragma once
 
+#include <bit>
+#include "Core/Logger.hpp"
 #include "ECS/Component.hpp"
+#include "ECS/ComponentType.hpp"
+#include "ECS/EntityManager.hpp"
+#include "ECS/GameObjectHandle.hpp"
 #include "Math/Transform.hpp"
+#include "Util/SlabAllocator.hpp"
+#include "Util/StringId.hpp"
 
+using namespace Invasion::Core;
 using namespace Invasion::Math;
 
 namespace Invasion::ECS
@@ -12,30 +20,47 @@ namespace Invasion::ECS
 
     public:
 
-        void Update()
+        // A GameObject dropped without CleanUp must not leave its entity behind: the ComponentReference columns hold raw
+        // pointers into components that die with it.
+        ~GameObject()
         {
-            LockGuard<Mutex> lock(mutex);
+            if (entity.IsValid())
+                EntityManager::GetInstance().Destroy(entity);
+        }
 
-            for (auto& [type, component] : components)
+        void Update()
+        {
+            for (Shared<Component>& component : GetComponents())
                 component->Update();
         }
 
         void Render(Shared<Invasion::Render::Camera> camera)
         {
-            LockGuard<Mutex> lock(mutex);
-
-            for (auto& [type, component] : components)
+            for (Shared<Component>& component : GetComponents())
                 component->Render(camera);
         }
 
         void CleanUp()
         {
-            LockGuard<Mutex> lock(mutex);
+            SmallVector<Shared<Component>, 8> removed;
+            Entity removedEntity;
+
+            {
+                LockGuard<Mutex> lock(mutex);
+
+                for (uint64_t mask = componentMask; mask != 0; mask &= mask - 1)
+                    removed += slots[std::countr_zero(mask)].exchange(nullptr, std::memory_order_acq_rel)->component;
+
+                componentMask = 0;
+                removedEntity = std::exchange(entity, {});
+                slotStorage.Clear();
+            }
 
-            for (auto& [type, component] : components)
+            for (Shared<Component>& component : removed)
                 component->CleanUp();
-         
-            components.Clear();
+
+            if (removedEntity.IsValid())
+                EntityManager::GetInstance().Destroy(removedEntity);
         }
 
         template <typename T>
@@ -43,55 +68,99 @@ namespace Invasion::ECS
         {
             static_assert(std::is_base_of<Component, T>::value, "T must derive from Component");
 
-            LockGuard<Mutex> lock(mutex);
+            size_t slot = ComponentType::GetSlot<T>();
+
+            if (slot >= MAX_COMPONENTS)
+                Logger_ThrowException("Too many component types for the GameObject slot table", true);
 
             component->gameObject = std::static_pointer_cast<GameObject>(shared_from_this());
             component->Initialize();
 
-            components += { typeid(T), std::move(component) };
+            Unique<ComponentSlot> entry = std::make_unique<ComponentSlot>(ComponentSlot{ component, [](Entity entity, Component* component)
+            {
+                EntityManager::GetInstance().Add(entity, ComponentReference<T>{ static_cast<T*>(component) });
+                component->OnAttach(entity);
+            } });
+
+            {
+                LockGuard<Mutex> lock(mutex);
+
+                const ComponentSlot* published = entry.get();
+
+                slotStorage |= std::move(entry);
+                slots[slot].store(published, std::memory_order_release);
+                componentMask |= uint64_t(1) << slot;
+
+                if (entity.IsValid())
+                    published->attach(entity, component.get());
+            }
 
-            return std::static_pointer_cast<T>(components[typeid(T)]);
+            NotifyComponentsChanged(component.get());
+
+            return component;
         }
 
+        // Lock-free: one acquire load of the published slot. Slots are never modified after publication and stay alive
+        // until CleanUp, so the Shared copy cannot race a concurrent AddComponent or RemoveComponent.
         template <typename T>
-        Shared<T> GetComponent()
+        Shared<T> GetComponent() const
         {
-            Shared<Component> component = nullptr;
+            size_t slot = ComponentType::GetSlot<T>();
 
-            {
-                if (components.Contains(typeid(T)))
-                    component = components[typeid(T)];
-            }
-
-            if (component != nullptr)
-                return std::static_pointer_cast<T>(component);
-            else
+            if (slot >= MAX_COMPONENTS)
                 return nullptr;
+
+            const ComponentSlot* published = slots[slot].load(std::memory_order_acquire);
+
+            return published ? std::static_pointer_cast<T>(published->component) : nullptr;
         }
 
         template <typename T>
-        bool HasComponent()
+        bool HasComponent() const
         {
-            LockGuard<Mutex> lock(mutex);
-            return components.Contains(typeid(T));
+            size_t slot = ComponentType::GetSlot<T>();
+
+            return slot < MAX_COMPONENTS && slots[slot].load(std::memory_order_acquire) != nullptr;
         }
 
         template <typename T>
         void RemoveComponent()
         {
-            LockGuard<Mutex> lock(mutex);
+            size_t slot = ComponentType::GetSlot<T>();
+
+            if (slot >= MAX_COMPONENTS)
+                return;
+
+            Shared<Component> removed;
 
-            if (components.Contains(typeid(T)))
             {
-                components[typeid(T)]->CleanUp();
-                components -= typeid(T);
+                LockGuard<Mutex> lock(mutex);
+
+                const ComponentSlot* published = slots[slot].exchange(nullptr, std::memory_order_acq_rel);
+
+                if (published == nullptr)
+                    return;
+
+                removed = published->component;
+                componentMask &= ~(uint64_t(1) << slot);
+
+                if (entity.IsValid())
+                {
+                    removed->OnDetach(entity);
+                    EntityManager::GetInstance().Remove<ComponentReference<T>>(entity);
+                }
             }
+
+            removed->CleanUp();
+
+            NotifyComponentsChanged(removed.get());
         }
 
         void SetName(const String& name)
         {
             LockGuard<Mutex> lock(mutex);
             this->name = name;
+            this->nameId = name;
         }
 
         String GetName() const
@@ -100,18 +169,24 @@ namespace Invasion::ECS
             return name;
         }
 
+        StringId GetNameId() const
+        {
+            LockGuard<Mutex> lock(mutex);
+            return nameId;
+        }
+
         void SetParent(Shared<GameObject> parent)
         {
             assert(parent != nullptr && "Parent cannot be null");
 
-            Shared<Transform> parentTransform;
+            Shared<Transform> parentTransform = parent->GetTransform();
+
             {
                 LockGuard<Mutex> lock(mutex);
                 this->parent = parent;
-                parentTransform = parent->GetTransform();
             }
 
-            GetTransform()->parent = parentTransform;
+            GetTransform()->SetParent(parentTransform);
         }
 
         Shared<GameObject> GetParent()
@@ -128,7 +203,7 @@ namespace Invasion::ECS
             child->SetParent(std::static_pointer_cast<GameObject>(shared_from_this()));
 
             {
-                children += { child->GetName(), child };
+                children += { child->GetNameId(), child };
             }
         }
 
@@ -139,43 +214,109 @@ namespace Invasion::ECS
                 parent.reset();
             }
 
-            GetTransform()->parent = nullptr;
+            GetTransform()->SetParent(nullptr);
         }
 
-        Shared<GameObject> GetChild(const String& name)
+        Shared<GameObject> GetChild(StringId name)
         {
-            if (children.Contains(name))
-                return children[name].lock();
+            Weak<GameObject> child;
+
+            if (children.Find(name, child))
+                return child.lock();
             else
                 return nullptr;
         }
 
-        void RemoveChild(const String& name)
+        // Never holds this object's mutex while taking the child's, so it cannot deadlock against the child's SetParent.
+        void RemoveChild(StringId name)
         {
-            LockGuard<Mutex> lock(mutex);
+            Weak<GameObject> weakChild;
+
+            if (!children.Find(name, weakChild))
+                return;
+
+            children -= name;
+
+            Shared<GameObject> child = weakChild.lock();
+
+            if (child == nullptr)
+                return;
 
-            if (children.Contains(name))
             {
-                Weak<GameObject> child = children[name];
-                {
-                    LockGuard<Mutex> childLock(child.lock()->mutex);
-                    child.lock()->parent.reset();
-                }
+                LockGuard<Mutex> childLock(child->mutex);
+                child->parent.reset();
+            }
+
+            child->GetTransform()->SetParent(nullptr);
+        }
+
+        void CreateEntity()
+        {
+            LockGuard<Mutex> lock(mutex);
 
-                children -= name;
+            if (entity.IsValid())
+                return;
+
+            entity = EntityManager::GetInstance().Create();
+
+            for (uint64_t mask = componentMask; mask != 0; mask &= mask - 1)
+            {
+                const ComponentSlot* published = slots[std::countr_zero(mask)].load(std::memory_order_relaxed);
+                published->attach(entity, published->component.get());
             }
         }
 
-        Shared<Transform> GetTransform()
+        SmallVector<Shared<GameObject>, 4> GetChildren()
+        {
+            SmallVector<Shared<GameObject>, 4> result;
+            FlatMap<StringId, Weak<GameObject>, SharedMutexLock> snapshot = children;
+
+            snapshot.ForEach([&result](const Weak<GameObject>& child)
+            {
+                if (Shared<GameObject> locked = child.lock())
+                    result += std::move(locked);
+            });
+
+            return result;
+        }
+
+        Entity GetEntity() const
+        {
+            LockGuard<Mutex> lock(mutex);
+            return entity;
+        }
+
+        GameObjectHandle GetHandle() const
+        {
+            LockGuard<Mutex> lock(mutex);
+            return handle;
+        }
+
+        Shared<Transform> GetTransform() const
         {
             return GetComponent<Transform>();
         }
 
+        static constexpr size_t MAX_COMPONENTS = 64;
+
         static Shared<GameObject> Create(const String& name)
         {
-            Shared<GameObject> result = std::make_shared<GameObject>();
+            Shared<GameObject> result = CreateDeferred(name);
+
+            result->CreateEntity();
+
+            return std::move(result);
+        }
+
+        // Builds the object and its component slots without touching the EntityManager, so worker threads never take
+        // its exclusive lock. The entity and its component references are added by CreateEntity, normally recorded
+        // through CommandBuffer::CreateEntity and run on the main thread at the next flush.
+        static Shared<GameObject> CreateDeferred(const String& name)
+        {
+            Shared<GameObject> result = MakePooled<GameObject>();
 
             result->name = name;
+            result->nameId = name;
             result->AddComponent(Transform::Create({ 0.0f, 0.0f, 0.0f }, { 0.0f, 0.0f, 0.0f }, { 1.0f, 1.0f, 1.0f }));
 
             return std::move(result);
@@ -183,12 +324,49 @@ namespace Invasion::ECS
 
     private:
 
+        friend class GameObjectManager;
+
+        void NotifyComponentsChanged(const Component* changed) const
+        {
+            for (Shared<Component>& component : GetComponents())
+            {
+                if (component.get() != changed)
+                    component->OnComponentsChanged();
+            }
+        }
+
+        // Components run without the object lock held so they can freely query or modify their own GameObject.
+        SmallVector<Shared<Component>, 8> GetComponents() const
+        {
+            LockGuard<Mutex> lock(mutex);
+
+            SmallVector<Shared<Component>, 8> result;
+
+            for (uint64_t mask = componentMask; mask != 0; mask &= mask - 1)
+                result += slots[std::countr_zero(mask)].load(std::memory_order_relaxed)->component;
+
+            return result;
+        }
+
         mutable Mutex mutex;
 
         String name;
+        StringId nameId;
+        Entity entity;
+        GameObjectHandle handle;
         Weak<GameObject> parent;
-        UnorderedMap<String, Weak<GameObject>> children;
-        UnorderedMap<TypeIndex, Shared<Component>> components;
+        FlatMap<StringId, Weak<GameObject>, SharedMutexLock> children;
+        // Immutable once published. Replaced or removed slots stay in slotStorage until CleanUp, so a reader that loaded a
+        // slot pointer just before it was swapped out still sees a live component.
+        struct ComponentSlot
+        {
+            Shared<Component> component;
+            void (*attach)(Entity, Component*);
+        };
+
+        Array<Atomic<const ComponentSlot*>, MAX_COMPONENTS> slots = {};
+        Vector<Unique<ComponentSlot>> slotStorage;
+        uint64_t componentMask = 0;
 
     };
 }
\ No newline at end of file
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Invasion::ECS
+{
+    struct GameObjectHandle
+    {
+        uint32_t index = INVALID_INDEX;
+        uint32_t generation = 0;
+
+        bool IsValid() const
+        {
+            return index != INVALID_INDEX;
+        }
+
+        uint64_t GetValue() const
+        {
+            return (static_cast<uint64_t>(generation) << 32) | index;
+        }
+
+        bool operator==(const GameObjectHandle& other) const
+        {
+            return index == other.index && generation == other.generation;
+        }
+
+        bool operator!=(const GameObjectHandle& other) const
+        {
+            return !(*this == other);
+        }
+
+        static GameObjectHandle FromValue(uint64_t value)
+        {
+            return { static_cast<uint32_t>(value), static_cast<uint32_t>(value >> 32) };
+        }
+
+        static constexpr uint32_t INVALID_INDEX = 0xFFFFFFFF;
+    };
+}
\ No newline at end of file
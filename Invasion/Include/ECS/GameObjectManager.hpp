@@ -1,6 +1,7 @@
 #pragma once
 
 #include "ECS/GameObject.hpp"
+#include "ECS/GameObjectHandle.hpp"
 
 namespace Invasion::ECS
 {
@@ -8,59 +9,171 @@ namespace Invasion::ECS
     {
     public:
 
-        Shared<GameObject> Register(Shared<GameObject> gameObject)
+        Shared<GameObject> Register(Shared<GameObject> gameObject, bool indexName = true)
         {
             LockGuard<Mutex> lock(mutex);
 
-            String name = gameObject->GetName();
+            uint32_t index;
 
-            gameObjects |= { name, gameObject };
+            if (freeHead != GameObjectHandle::INVALID_INDEX)
+            {
+                index = freeHead;
+                freeHead = slots[index].nextFree;
+            }
+            else
+            {
+                index = static_cast<uint32_t>(slots.Length());
+                slots += Slot{};
+            }
 
-            return gameObjects[name];
+            Slot& slot = slots[index];
+
+            slot.denseIndex = static_cast<uint32_t>(gameObjects.Length());
+            slot.nextFree = GameObjectHandle::INVALID_INDEX;
+
+            GameObjectHandle handle{ index, slot.generation };
+
+            {
+                LockGuard<Mutex> objectLock(gameObject->mutex);
+                gameObject->handle = handle;
+            }
+
+            if (indexName)
+                names[gameObject->GetNameId()] = handle;
+
+            gameObjects += gameObject;
+            denseToSlot += index;
+
+            return gameObject;
         }
 
-        Shared<GameObject> Get(const String& name)
+        Shared<GameObject> Get(GameObjectHandle handle)
+        {
+            LockGuard<Mutex> lock(mutex);
+
+            if (!IsValidUnlocked(handle))
+                return nullptr;
+
+            return gameObjects[slots[handle.index].denseIndex];
+        }
+
+        Shared<GameObject> Get(StringId name)
         {
             LockGuard<Mutex> lock(mutex); 
 
-            if (gameObjects.Contains(name))
-                return gameObjects[name];
-            else
+            GameObjectHandle handle;
+
+            if (!names.Find(name, handle) || !IsValidUnlocked(handle))
                 return nullptr;
+
+            return gameObjects[slots[handle.index].denseIndex];
+        }
+
+        bool IsValid(GameObjectHandle handle)
+        {
+            LockGuard<Mutex> lock(mutex);
+            return IsValidUnlocked(handle);
         }
 
-        void Unregister(const String& name)
+        void Unregister(GameObjectHandle handle)
         {
             LockGuard<Mutex> lock(mutex);
 
-            if (gameObjects.Contains(name)) 
+            if (!IsValidUnlocked(handle))
+                return;
+
+            Slot& slot = slots[handle.index];
+            uint32_t denseIndex = slot.denseIndex;
+
+            Shared<GameObject> gameObject = std::move(gameObjects[denseIndex]);
+
+            gameObjects.SwapRemove(denseIndex);
+            denseToSlot.SwapRemove(denseIndex);
+
+            if (denseIndex < denseToSlot.Length())
+                slots[denseToSlot[denseIndex]].denseIndex = denseIndex;
+
+            ++slot.generation;
+            slot.denseIndex = GameObjectHandle::INVALID_INDEX;
+            slot.nextFree = freeHead;
+            freeHead = handle.index;
+
+            StringId name = gameObject->GetNameId();
+            GameObjectHandle namedHandle;
+
+            if (names.Find(name, namedHandle) && namedHandle == handle)
+                names -= name;
+
+            gameObject->CleanUp();
+        }
+
+        void Unregister(StringId name)
+        {
+            GameObjectHandle handle;
+
             {
-                gameObjects[name]->CleanUp();
-                gameObjects[name].reset();
-                gameObjects -= name;
+                LockGuard<Mutex> lock(mutex);
+
+                if (!names.Find(name, handle))
+                    return;
             }
+
+            Unregister(handle);
         }
 
-        void Update()
+        // Each root hierarchy is updated by a single task, parents before children, so components that touch their
+        // own transforms and children never race. Separate hierarchies update in parallel.
+        void Update(ThreadPool& threadPool)
         {
-            LockGuard<Mutex> lock(mutex);
+            {
+                LockGuard<Mutex> lock(mutex);
+
+                for (Shared<GameObject>& gameObject : gameObjects)
+                {
+                    if (gameObject->GetParent() == nullptr)
+                        updateList += gameObject;
+                }
+            }
+
+            threadPool.ParallelForEach(updateList, [this](Shared<GameObject>& root) { UpdateHierarchy(*root); });
 
-            gameObjects.ForEach([](String, Shared<GameObject> gameObject) { gameObject->Update(); });
+            updateList.Clear();
         }
 
         void Render(Shared<Invasion::Render::Camera> camera)
         {
             LockGuard<Mutex> lock(mutex);
 
-            gameObjects.ForEach([camera](String, Shared<GameObject> gameObject) { gameObject->Render(camera); });
+            gameObjects.ForEach([&camera](Shared<GameObject>& gameObject) { gameObject->Render(camera); });
         }
 
         void CleanUp()
         {
             LockGuard<Mutex> lock(mutex);
 
-            gameObjects.ForEach([](String, Shared<GameObject> gameObject) { gameObject->CleanUp(); });
+            for (Shared<GameObject>& gameObject : gameObjects)
+                gameObject->CleanUp();
+
             gameObjects.Clear();
+            denseToSlot.Clear();
+            names.Clear();
+
+            for (uint32_t index = 0; index < slots.Length(); ++index)
+            {
+                if (slots[index].denseIndex != GameObjectHandle::INVALID_INDEX)
+                {
+                    ++slots[index].generation;
+                    slots[index].denseIndex = GameObjectHandle::INVALID_INDEX;
+                    slots[index].nextFree = freeHead;
+                    freeHead = index;
+                }
+            }
+        }
+
+        size_t GetCount()
+        {
+            LockGuard<Mutex> lock(mutex);
+            return gameObjects.Length();
         }
 
         static GameObjectManager& GetInstance()
@@ -71,9 +184,38 @@ namespace Invasion::ECS
 
     private:
 
+        struct Slot
+        {
+            uint32_t generation = 0;
+            uint32_t denseIndex = GameObjectHandle::INVALID_INDEX;
+            uint32_t nextFree = GameObjectHandle::INVALID_INDEX;
+        };
+
         GameObjectManager() = default;
 
+        void UpdateHierarchy(GameObject& gameObject)
+        {
+            gameObject.Update();
+
+            for (Shared<GameObject>& child : gameObject.GetChildren())
+            {
+                if (IsValid(child->GetHandle()))
+                    UpdateHierarchy(*child);
+            }
+        }
+
+        bool IsValidUnlocked(GameObjectHandle handle) const
+        {
+            return handle.index < slots.Length() && slots[handle.index].generation == handle.generation && slots[handle.index].denseIndex != GameObjectHandle::INVALID_INDEX;
+        }
+
         Mutex mutex;
-        OrderedMap<String, Shared<GameObject>> gameObjects;
+
+        Vector<Slot> slots;
+        Vector<Shared<GameObject>> gameObjects;
+        Vector<Shared<GameObject>> updateList;
+        Vector<uint32_t> denseToSlot;
+        FlatMap<StringId, GameObjectHandle, NoLock> names;
+        uint32_t freeHead = GameObjectHandle::INVALID_INDEX;
     };
 }
\ No newline at end of file
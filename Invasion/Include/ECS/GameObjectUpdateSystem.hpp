@@ -0,0 +1,35 @@
+#pragma once
+
+#include "ECS/GameObjectManager.hpp"
+#include "ECS/System.hpp"
+
+namespace Invasion::ECS
+{
+    class GameObjectUpdateSystem : public System
+    {
+
+    public:
+
+        void Update(ThreadPool& threadPool) override
+        {
+            GameObjectManager::GetInstance().Update(threadPool);
+        }
+
+        static Shared<GameObjectUpdateSystem> Create()
+        {
+            class Enabled : public GameObjectUpdateSystem { };
+
+            return std::make_shared<Enabled>();
+        }
+
+    protected:
+
+        // Component updates run arbitrary code, so no other system may overlap them; the hierarchies themselves are
+        // spread across the pool by GameObjectManager::Update.
+        GameObjectUpdateSystem() : System("GameObjectUpdate")
+        {
+            Exclusive();
+        }
+
+    };
+}
\ No newline at end of file
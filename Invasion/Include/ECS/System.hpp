@@ -0,0 +1,100 @@
+#pragma once
+
+#include "ECS/ComponentType.hpp"
+#include "Thread/ThreadPool.hpp"
+#include "Util/Typedefs.hpp"
+
+using namespace Invasion::Thread;
+using namespace Invasion::Util;
+
+namespace Invasion::ECS
+{
+    class System
+    {
+
+    public:
+
+        System(const System&) = delete;
+        System& operator=(const System&) = delete;
+
+        virtual ~System() = default;
+
+        virtual void Update(ThreadPool& threadPool) = 0;
+
+        bool ConflictsWith(const System& other) const
+        {
+            if (exclusive || other.exclusive)
+                return true;
+
+            for (size_t id : writes)
+            {
+                if (other.Accesses(id))
+                    return true;
+            }
+
+            for (size_t id : other.writes)
+            {
+                if (Accesses(id))
+                    return true;
+            }
+
+            return false;
+        }
+
+        bool IsExclusive() const
+        {
+            return exclusive;
+        }
+
+        const char* GetName() const
+        {
+            return name;
+        }
+
+    protected:
+
+        explicit System(const char* name) : name(name) { }
+
+        template <typename... Ts>
+        void Reads()
+        {
+            ((reads += ComponentType::GetId<Ts>()), ...);
+        }
+
+        template <typename... Ts>
+        void Writes()
+        {
+            ((writes += ComponentType::GetId<Ts>()), ...);
+        }
+
+        void Exclusive()
+        {
+            exclusive = true;
+        }
+
+    private:
+
+        bool Accesses(size_t id) const
+        {
+            for (size_t read : reads)
+            {
+                if (read == id)
+                    return true;
+            }
+
+            for (size_t write : writes)
+            {
+                if (write == id)
+                    return true;
+            }
+
+            return false;
+        }
+
+        const char* name;
+        Vector<size_t> reads;
+        Vector<size_t> writes;
+        bool exclusive = false;
+
+    };
+}
\ No newline at end of file
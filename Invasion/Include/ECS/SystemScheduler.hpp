@@ -0,0 +1,117 @@
+#pragma once
+
+#include "ECS/System.hpp"
+#include "Thread/Job.hpp"
+#include "Util/Typedefs.hpp"
+
+using namespace Invasion::Thread;
+using namespace Invasion::Util;
+
+namespace Invasion::ECS
+{
+    class SystemScheduler
+    {
+
+    public:
+
+        SystemScheduler(const SystemScheduler&) = delete;
+        SystemScheduler& operator=(const SystemScheduler&) = delete;
+
+        template <typename T>
+        Shared<T> Register(Shared<T> system)
+        {
+            static_assert(std::is_base_of<System, T>::value, "T must derive from System");
+
+            LockGuard<Mutex> lock(mutex);
+
+            systems += system;
+
+            return system;
+        }
+
+        void Update(ThreadPool& threadPool)
+        {
+            LockGuard<Mutex> lock(mutex);
+
+            Vector<Shared<Job>> jobs;
+            Vector<Shared<Job>> running;
+            std::exception_ptr exception;
+
+            jobs.Resize(systems.Length());
+
+            for (size_t i = 0; i < systems.Length(); ++i)
+            {
+                System* system = systems[i].get();
+
+                if (system->IsExclusive())
+                {
+                    WaitFor(running, exception);
+
+                    for (Shared<Job>& job : jobs)
+                        job.reset();
+
+                    try
+                    {
+                        system->Update(threadPool);
+                    }
+                    catch (...)
+                    {
+                        if (!exception)
+                            exception = std::current_exception();
+                    }
+
+                    continue;
+                }
+
+                jobs[i] = Job::Create(threadPool, [system, &threadPool] { system->Update(threadPool); }, TaskPriority::CRITICAL, {}, system->GetName());
+
+                for (size_t j = 0; j < i; ++j)
+                {
+                    if (jobs[j] && system->ConflictsWith(*systems[j]))
+                        jobs[i]->DependsOn(jobs[j]);
+                }
+
+                jobs[i]->Submit();
+                running += jobs[i];
+            }
+
+            WaitFor(running, exception);
+
+            if (exception)
+                std::rethrow_exception(exception);
+        }
+
+        size_t GetSystemCount()
+        {
+            LockGuard<Mutex> lock(mutex);
+            return systems.Length();
+        }
+
+        static SystemScheduler& GetInstance()
+        {
+            static SystemScheduler instance;
+            return instance;
+        }
+
+    private:
+
+        SystemScheduler() = default;
+
+        static void WaitFor(Vector<Shared<Job>>& running, std::exception_ptr& exception)
+        {
+            for (Shared<Job>& job : running)
+            {
+                job->Wait();
+
+                if (job->GetException() && !exception)
+                    exception = job->GetException();
+            }
+
+            running.Clear();
+        }
+
+        Mutex mutex;
+        Vector<Shared<System>> systems;
+
+    };
+}
\ No newline at end of file
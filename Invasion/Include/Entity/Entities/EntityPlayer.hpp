@@ -22,10 +22,12 @@ namespace Invasion::Entity::Entities
 			InputManager::GetInstance().SetCursorState(CursorState::LOCKED);
 
 			GetGameObject()->AddChild(GameObjectManager::GetInstance().Register(GameObject::Create("Camera")));
-			GetGameObject()->GetChild("Camera")->AddComponent(Camera::Create(45.0f, 0.01f, 1000.0f));
+			GetGameObject()->GetChild("Camera"_sid)->AddComponent(Camera::Create(45.0f, 0.01f, 1000.0f));
 		}
 
-		virtual void Update() override
+		// Driven by EntityPlayerSystem rather than the generic component Update, so the scheduler knows it writes
+		// transforms and reads input.
+		void UpdateControls()
 		{
 			UpdateMouseLook();
 			UpdateMovement();
@@ -33,7 +35,7 @@ namespace Invasion::Entity::Entities
 
 		Shared<Camera> GetCamera() const
 		{
-			return GetGameObject()->GetChild("Camera")->GetComponent<Camera>();
+			return GetGameObject()->GetChild("Camera"_sid)->GetComponent<Camera>();
 		}
 
 	protected:
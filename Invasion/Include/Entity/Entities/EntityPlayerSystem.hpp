@@ -0,0 +1,41 @@
+#pragma once
+
+#include "ECS/EntityManager.hpp"
+#include "ECS/System.hpp"
+#include "Entity/Entities/EntityPlayer.hpp"
+
+using namespace Invasion::ECS;
+
+namespace Invasion::Entity::Entities
+{
+	class EntityPlayerSystem : public System
+	{
+
+	public:
+
+		void Update(ThreadPool& threadPool) override
+		{
+			EntityManager::GetInstance().ParallelForEach<ComponentReference<EntityPlayer>>(threadPool, [](ECS::Entity, ComponentReference<EntityPlayer>& player)
+			{
+				player.component->UpdateControls();
+			});
+		}
+
+		static Shared<EntityPlayerSystem> Create()
+		{
+			class Enabled : public EntityPlayerSystem { };
+
+			return std::make_shared<Enabled>();
+		}
+
+	protected:
+
+		// Input is only read here; InputSystem is exclusive, so it has finished writing before this system starts.
+		EntityPlayerSystem() : System("EntityPlayer")
+		{
+			Reads<ComponentReference<EntityPlayer>>();
+			Writes<Transform>();
+		}
+
+	};
+}
\ No newline at end of file
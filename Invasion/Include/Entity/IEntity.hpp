@@ -1,6 +1,7 @@
 #pragma once
 
 #include "ECS/GameObject.hpp"
+#include "Util/SlabAllocator.hpp"
 
 namespace Invasion::Entity
 {
@@ -121,7 +122,7 @@ namespace Invasion::Entity
 			static_assert(std::is_base_of<IEntity, T>::value, "T must derive from IEntity.");
 
 			class Enabled : public T { };
-			Shared<T> result = std::make_shared<Enabled>();
+			Shared<T> result = MakePooled<Enabled>();
 
 			EntityRegistration registration = result->GetRegistration();
 
@@ -1,11 +1,20 @@
 #pragma once
 
+#include "Core/InputSystem.hpp"
+#include "ECS/CommandBuffer.hpp"
 #include "ECS/GameObjectManager.hpp"
+#include "ECS/GameObjectUpdateSystem.hpp"
+#include "ECS/SystemScheduler.hpp"
 #include "Entity/Entities/EntityPlayer.hpp"
+#include "Entity/Entities/EntityPlayerSystem.hpp"
+#include "Math/TransformUpdateSystem.hpp"
 #include "Render/Mesh.hpp"
+#include "Render/MeshRenderKeySystem.hpp"
 #include "Render/Renderer.hpp"
 #include "Render/ShaderManager.hpp"
 #include "Render/TextureManager.hpp"
+#include "Thread/MainThreadDispatcher.hpp"
+#include "Thread/ThreadPool.hpp"
 #include "Util/Typedefs.hpp"
 #include "Util/XXMLParser.hpp"
 #include "World/Chunk.hpp"
@@ -15,6 +24,7 @@
 using namespace Invasion::Entity;
 using namespace Invasion::Entity::Entities;
 using namespace Invasion::Render;
+using namespace Invasion::Thread;
 using namespace Invasion::World;
 
 namespace Invasion
@@ -98,12 +108,22 @@ namespace Invasion
 
 				return DefWindowProc(handle, message, wParam, lParam);
 			});
+
+#ifdef _DEBUG
+			if (!ChunkKey::CheckHashDistribution())
+				Logger_ThrowException("Chunk coordinate hashing is degenerate.", false);
+#endif
 		}
 
 		void Initialize()
 		{
 			Renderer::GetInstance().Initialize();
 
+			// The atlas loads and packs on a worker while the shader and textures below load here. Its GPU upload hops
+			// back to this thread, which RunUntilComplete keeps draining until the atlas is ready.
+			Task<Shared<TextureAtlas>> atlasTask = TextureAtlas::CreateAsync(threadPool, "default", "Assets/Invasion/Texture/Block", "Assets/Invasion/Texture/Atlas");
+			atlasTask.Start();
+
 			ShaderManager::GetInstance().Register(Shader::Create("default", "Shader/Default"));
 
 			D3D11_SAMPLER_DESC samplerDescription = {};
@@ -122,10 +142,18 @@ namespace Invasion
 			samplerDescription.MinLOD = 0;
 			samplerDescription.MaxLOD = D3D11_FLOAT32_MAX;
 
-			TextureAtlasManager::GetInstance().Register(TextureAtlas::Create("default", "Assets/Invasion/Texture/Block", "Assets/Invasion/Texture/Atlas"));
-
 			TextureManager::GetInstance().Register(Texture::Create("debug", "Texture/Debug.dds", samplerDescription));
 
+			TextureAtlasManager::GetInstance().Register(MainThreadDispatcher::GetInstance().RunUntilComplete(atlasTask));
+
+			// Input and the generic component updates are exclusive barriers. After them, EntityPlayer writes transforms
+			// and TransformUpdate waits on it to read them, while MeshRenderKey touches neither and runs alongside both.
+			SystemScheduler::GetInstance().Register(InputSystem::Create());
+			SystemScheduler::GetInstance().Register(GameObjectUpdateSystem::Create());
+			SystemScheduler::GetInstance().Register(EntityPlayerSystem::Create());
+			SystemScheduler::GetInstance().Register(TransformUpdateSystem::Create());
+			SystemScheduler::GetInstance().Register(MeshRenderKeySystem::Create());
+
 			player = GameObjectManager::GetInstance().Register(GameObject::Create("Player"));
 
 			player->AddComponent(IEntity::Create<EntityPlayer>());
@@ -134,25 +162,46 @@ namespace Invasion
 
 		void Update()
 		{
-			IWorld::GetInstance().Update(player->GetTransform()->GetWorldPosition());
+			MainThreadDispatcher::GetInstance().Execute();
 
-			InputManager::GetInstance().Update();
-			GameObjectManager::GetInstance().Update();
+			IWorld::GetInstance().Update(threadPool, player->GetTransform()->GetWorldPosition());
 
-			IWorld::GetInstance().WaitForUpdate();
+			SystemScheduler::GetInstance().Update(threadPool);
+
+			CommandBuffer::FlushAll();
+
+			if constexpr (MemoryTracker::ENABLED)
+				ReportMemory();
 		}
 
 		void Render()
 		{
 			Renderer::GetInstance().PreRender();
 
-			GameObjectManager::GetInstance().Render(player->GetComponent<EntityPlayer>()->GetCamera());
+			Shared<Camera> camera = player->GetComponent<EntityPlayer>()->GetCamera();
+
+			ArenaVector<MeshDraw> draws;
+
+			EntityManager::GetInstance().View<ComponentReference<Mesh>, TransformData, MeshRenderKey>().ForEach([&draws](ECS::Entity, ComponentReference<Mesh>& mesh, TransformData& transform, MeshRenderKey& key)
+			{
+				draws += MeshDraw{ key.value, mesh.component, transform.worldMatrix };
+			});
+
+			std::sort(draws.begin(), draws.end(), [](const MeshDraw& a, const MeshDraw& b) { return a.key < b.key; });
+
+			for (const MeshDraw& draw : draws)
+				draw.mesh->Draw(camera, draw.worldMatrix);
 
 			Renderer::GetInstance().PostRender();
+
+			LinearArena::EndFrame();
 		}
 
 		void CleanUp()
 		{
+			IWorld::GetInstance().WaitForUpdate();
+			MainThreadDispatcher::GetInstance().CleanUp();
+			CommandBuffer::FlushAll();
 			GameObjectManager::GetInstance().CleanUp();
 			TextureAtlasManager::GetInstance().CleanUp();
 			ShaderManager::GetInstance().CleanUp();
@@ -169,10 +218,35 @@ namespace Invasion
 
 	private:
 
-		InvasionGame() = default;
+		struct MeshDraw
+		{
+			uint64_t key;
+			Mesh* mesh;
+			Matrix worldMatrix;
+		};
+
+		InvasionGame() : threadPool(std::max(2u, std::thread::hardware_concurrency()) - 1) { }
+
+		void ReportMemory()
+		{
+			SteadyClock::time_point now = SteadyClock::now();
+
+			if (now - lastMemoryReport < MEMORY_REPORT_INTERVAL)
+				return;
+
+			lastMemoryReport = now;
+
+			Logger_WriteConsole(MemoryTracker::GetSnapshot().ToString(), LogLevel::DEBUGGING);
+		}
+
+		static constexpr std::chrono::seconds MEMORY_REPORT_INTERVAL = std::chrono::seconds(10);
+
+		ThreadPool threadPool;
 
 		Shared<GameObject> player = nullptr;
 		Shared<GameObject> mesh = nullptr;
 
+		SteadyClock::time_point lastMemoryReport = SteadyClock::now();
+
 	};
 }
\ No newline at end of file
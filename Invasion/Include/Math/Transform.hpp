@@ -1,7 +1,9 @@
 #pragma once
 
 #include "ECS/Component.hpp"
+#include "ECS/EntityManager.hpp"
 #include "Math/Vector3.hpp"
+#include "Util/SlabAllocator.hpp"
 #include "Util/Typedefs.hpp"
 
 using namespace Invasion::ECS;
@@ -9,6 +11,18 @@ using namespace Invasion::Util;
 
 namespace Invasion::Math
 {
+	class TransformSystem;
+
+	// By-value copy of a transform's state as of the last TransformSystem update, stored in the entity's archetype
+	// columns so systems and the renderer can iterate it contiguously instead of chasing ComponentReference pointers.
+	struct TransformData
+	{
+		Vector3f localPosition;
+		Vector3f localRotation;
+		Vector3f localScale;
+		Matrix worldMatrix;
+	};
+
 	class Transform : public Component
 	{
 
@@ -17,19 +31,54 @@ namespace Invasion::Math
 		Transform(const Transform&) = delete;
 		Transform& operator=(const Transform&) = delete;
 
+		~Transform()
+		{
+			LockGuard<Mutex> hierarchyLock(hierarchyMutex);
+
+			if (parent)
+				parent->children -= this;
+
+			if (queued.load(std::memory_order_acquire))
+			{
+				LockGuard<Mutex> lock(pendingMutex);
+				pending -= this;
+			}
+		}
+
 		void Translate(const Vector3f& translation)
 		{
-			localPosition += translation;
+			LockGuard<Mutex> hierarchyLock(hierarchyMutex);
+
+			{
+				LockGuard<Mutex> lock(matrixMutex);
+				localPosition += translation;
+			}
+
+			MarkLocalDirty();
 		}
 
 		void Rotate(const Vector3f& rotation)
 		{
-			localRotation += rotation;
+			LockGuard<Mutex> hierarchyLock(hierarchyMutex);
+
+			{
+				LockGuard<Mutex> lock(matrixMutex);
+				localRotation += rotation;
+			}
+
+			MarkLocalDirty();
 		}
 
 		void Scale(const Vector3f& scale)
 		{
-			localScale += scale;
+			LockGuard<Mutex> hierarchyLock(hierarchyMutex);
+
+			{
+				LockGuard<Mutex> lock(matrixMutex);
+				localScale += scale;
+			}
+
+			MarkLocalDirty();
 		}
 
 		Vector3f GetForward() const
@@ -89,48 +138,208 @@ namespace Invasion::Math
 			return Vector3f(scaleX, scaleY, scaleZ);
 		}
 
-		Vector3f GetLocalPosition() const { return localPosition; }
-		Vector3f GetLocalRotation() const { return localRotation; }
-		Vector3f GetLocalScale() const { return localScale; }
+		Vector3f GetLocalPosition() const { LockGuard<Mutex> lock(matrixMutex); return localPosition; }
+		Vector3f GetLocalRotation() const { LockGuard<Mutex> lock(matrixMutex); return localRotation; }
+		Vector3f GetLocalScale() const { LockGuard<Mutex> lock(matrixMutex); return localScale; }
+
+		void SetLocalPosition(const Vector3f& position) { SetLocal(localPosition, position); }
+		void SetLocalRotation(const Vector3f& rotation) { SetLocal(localRotation, rotation); }
+		void SetLocalScale(const Vector3f& scale) { SetLocal(localScale, scale); }
+
+		void SetParent(Shared<Transform> parent)
+		{
+			if (this->parent == parent)
+				return;
+
+			Shared<Transform> previous;
+
+			{
+				LockGuard<Mutex> hierarchyLock(hierarchyMutex);
+
+				if (this->parent)
+					this->parent->children -= this;
+
+				{
+					LockGuard<Mutex> lock(matrixMutex);
+					previous = std::exchange(this->parent, std::move(parent));
+				}
+
+				if (this->parent)
+					this->parent->children += this;
+
+				PropagateWorldDirty(true);
+				Enqueue();
+			}
+		}
+
+		Shared<Transform> GetParent() const
+		{
+			LockGuard<Mutex> lock(matrixMutex);
+			return parent;
+		}
+
+		void OnAttach(ECS::Entity entity) override
+		{
+			this->entity.store(entity, std::memory_order_release);
 
-		void SetLocalPosition(const Vector3f& position) { localPosition = position; }
-		void SetLocalRotation(const Vector3f& rotation) { localRotation = rotation; }
-		void SetLocalScale(const Vector3f& scale) { localScale = scale; }
+			EntityManager::GetInstance().Add(entity, GetData());
+		}
+
+		void OnDetach(ECS::Entity entity) override
+		{
+			this->entity.store({}, std::memory_order_release);
+
+			EntityManager::GetInstance().Remove<TransformData>(entity);
+		}
+
+		// Getters rebuild a dirty matrix on read, at most once per change, under this transform's mutex; the world matrix
+		// pulls the parent's through the same path. TransformSystem::Update only prefetches the matrices of everything
+		// changed this frame in one batch, so most reads find them clean.
+		Matrix GetLocalMatrix() const
+		{
+			LockGuard<Mutex> lock(matrixMutex);
+
+			RebuildLocalMatrix();
+
+			return localMatrix;
+		}
 
 		Matrix GetWorldMatrix() const
 		{
-			Matrix translation = DirectX::XMMatrixTranslation(localPosition.x, localPosition.y, localPosition.z);
-			Matrix rotation = DirectX::XMMatrixRotationRollPitchYaw(localRotation.x, localRotation.y, localRotation.z);
-			Matrix scale = DirectX::XMMatrixScaling(localScale.x, localScale.y, localScale.z);
+			LockGuard<Mutex> lock(matrixMutex);
 
-			Matrix localTransform = scale * rotation * translation;
+			if (worldDirty.load(std::memory_order_acquire))
+			{
+				RebuildLocalMatrix();
 
-			if (parent)
-				return localTransform * parent->GetWorldMatrix();
-			else
-				return localTransform;
+				worldMatrix = parent ? localMatrix * parent->GetWorldMatrix() : localMatrix;
+				worldDirty.store(false, std::memory_order_release);
+			}
+
+			return worldMatrix;
 		}
 
 		static Shared<Transform> Create(const Vector3f& position, const Vector3f& rotation, const Vector3f& scale)
 		{
 			class Enabled : public Transform { };
-			Shared<Transform> result = std::make_shared<Enabled>();
+			Shared<Transform> result = MakePooled<Enabled>();
 
-			result->SetLocalPosition(position);
-			result->SetLocalRotation(rotation);
-			result->SetLocalScale(scale);
+			result->localPosition = position;
+			result->localRotation = rotation;
+			result->localScale = scale;
+			result->GetWorldMatrix();
 
 			return std::move(result);
 		}
-		
-		Shared<Transform> parent;
 
 	private:
 
+		friend class TransformSystem;
+
 		Transform() = default;
 
+		// Setters hold hierarchyMutex so the local TRS never changes while TransformSystem::Update has it in flight.
+		void SetLocal(Vector3f& member, const Vector3f& value)
+		{
+			LockGuard<Mutex> hierarchyLock(hierarchyMutex);
+
+			{
+				LockGuard<Mutex> lock(matrixMutex);
+				member = value;
+			}
+
+			MarkLocalDirty();
+		}
+
+		void MarkLocalDirty()
+		{
+			localDirty.store(true, std::memory_order_release);
+
+			PropagateWorldDirty(true);
+			Enqueue();
+		}
+
+		TransformData GetData() const
+		{
+			Matrix world = GetWorldMatrix();
+
+			LockGuard<Mutex> lock(matrixMutex);
+
+			return { localPosition, localRotation, localScale, world };
+		}
+
+		void RebuildLocalMatrix() const
+		{
+			if (!localDirty.load(std::memory_order_acquire))
+				return;
+
+			Matrix translation = DirectX::XMMatrixTranslation(localPosition.x, localPosition.y, localPosition.z);
+			Matrix rotation = DirectX::XMMatrixRotationRollPitchYaw(localRotation.x, localRotation.y, localRotation.z);
+			Matrix scale = DirectX::XMMatrixScaling(localScale.x, localScale.y, localScale.z);
+
+			localMatrix = scale * rotation * translation;
+			localDirty.store(false, std::memory_order_release);
+		}
+
+		// Marks this transform and its subtree world-dirty, stopping at children that are already dirty: a dirty transform
+		// never has a clean descendant, because a getter only cleans a child after cleaning its parent chain. Each flag is
+		// set under its own transform's mutex so it cannot race a getter that is about to clear it.
+		void PropagateWorldDirty(bool force)
+		{
+			{
+				LockGuard<Mutex> lock(matrixMutex);
+
+				if (!force && worldDirty.load(std::memory_order_relaxed))
+					return;
+
+				worldDirty.store(true, std::memory_order_release);
+			}
+
+			for (Transform* child : children)
+				child->PropagateWorldDirty(false);
+		}
+
+		// Called by TransformSystem with matrices computed from the local TRS it gathered under hierarchyMutex, which
+		// setters also hold, so they match what a getter would rebuild.
+		void StoreMatrices(const Matrix& local, const Matrix& world)
+		{
+			LockGuard<Mutex> lock(matrixMutex);
+
+			localMatrix = local;
+			worldMatrix = world;
+			localDirty.store(false, std::memory_order_release);
+			worldDirty.store(false, std::memory_order_release);
+		}
+
+		void Enqueue()
+		{
+			if (queued.exchange(true, std::memory_order_acq_rel))
+				return;
+
+			LockGuard<Mutex> lock(pendingMutex);
+			pending += this;
+		}
+
 		Vector3f localPosition;
 		Vector3f localRotation;
 		Vector3f localScale;
+
+		Shared<Transform> parent;
+		Vector<Transform*> children;
+
+		mutable Mutex matrixMutex;
+		mutable Matrix localMatrix = DirectX::XMMatrixIdentity();
+		mutable Matrix worldMatrix = DirectX::XMMatrixIdentity();
+		mutable Atomic<bool> localDirty = true;
+		mutable Atomic<bool> worldDirty = true;
+		Atomic<bool> queued = false;
+		Atomic<ECS::Entity> entity;
+		bool collected = false;
+
+		// Held by TransformSystem::Update for the whole update and by anything that edits the child lists, so a transform
+		// cannot be destroyed or reparented while the update holds raw pointers to it.
+		static inline Mutex hierarchyMutex;
+		static inline Mutex pendingMutex;
+		static inline Vector<Transform*> pending;
 	};
 }
\ No newline at end of file
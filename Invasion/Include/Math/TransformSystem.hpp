@@ -0,0 +1,262 @@
+#pragma once
+
+#include <DirectXMath.h>
+#include "Math/Transform.hpp"
+#include "Thread/ThreadPool.hpp"
+#include "Util/Typedefs.hpp"
+
+using namespace Invasion::Thread;
+using namespace Invasion::Util;
+
+namespace Invasion::Math
+{
+	class TransformSystem
+	{
+
+	public:
+
+		TransformSystem(const TransformSystem&) = delete;
+		TransformSystem& operator=(const TransformSystem&) = delete;
+
+		void Update(ThreadPool& threadPool)
+		{
+			LockGuard<Mutex> hierarchyLock(Transform::hierarchyMutex);
+
+			{
+				LockGuard<Mutex> lock(Transform::pendingMutex);
+				queue.Swap(Transform::pending);
+			}
+
+			if (queue.IsEmpty())
+				return;
+
+			for (Transform* transform : queue)
+				transform->queued.store(false, std::memory_order_release);
+
+			ClearRows();
+
+			for (Transform* transform : queue)
+				CollectRoots(transform);
+
+			queue.Clear();
+
+			for (size_t levelBegin = 0; levelBegin < transforms.Length(); )
+			{
+				size_t levelEnd = transforms.Length();
+
+				UpdateLevel(threadPool, levelBegin, levelEnd);
+
+				for (size_t row = levelBegin; row < levelEnd; ++row)
+				{
+					for (Transform* child : transforms[row]->children)
+					{
+						if (child->collected)
+							continue;
+
+						if (child->worldDirty.load(std::memory_order_acquire))
+							AddRow(child, static_cast<uint32_t>(row));
+						else
+							CollectRoots(child);
+					}
+				}
+
+				levelBegin = levelEnd;
+			}
+
+			EntityManager::GetInstance().ForEachOf<TransformData>(&entities[0], entities.Length(), [this](size_t row, TransformData& data)
+			{
+				data = { positions[row], rotations[row], scales[row], worldMatrices[row] };
+			});
+		}
+
+		static TransformSystem& GetInstance()
+		{
+			static TransformSystem instance;
+			return instance;
+		}
+
+		static constexpr size_t BATCH_SIZE = 4;
+		static constexpr size_t BATCHES_PER_TASK = 16;
+
+	private:
+
+		TransformSystem() = default;
+
+		void ClearRows()
+		{
+			transforms.Clear();
+			entities.Clear();
+			positions.Clear();
+			rotations.Clear();
+			scales.Clear();
+			parentRows.Clear();
+			parentMatrices.Clear();
+			localMatrices.Clear();
+			worldMatrices.Clear();
+		}
+
+		// Appends a dirty transform to the topologically sorted rows: every row comes after its parent's row, and rows of
+		// the same depth are contiguous, so each level is one streaming pass over the TRS arrays.
+		void AddRow(Transform* transform, uint32_t parentRow)
+		{
+			transform->collected = true;
+
+			transforms += transform;
+			entities += transform->entity.load(std::memory_order_acquire);
+			positions += transform->localPosition;
+			rotations += transform->localRotation;
+			scales += transform->localScale;
+			parentRows += parentRow;
+			parentMatrices += parentRow == NO_PARENT && transform->parent ? transform->parent->GetWorldMatrix() : DirectX::XMMatrixIdentity();
+			localMatrices += DirectX::XMMatrixIdentity();
+			worldMatrices += DirectX::XMMatrixIdentity();
+		}
+
+		void CollectRoots(Transform* transform)
+		{
+			// A getter may have rebuilt a queued transform already; its dirty descendants then start their own rows.
+			if (!transform->worldDirty.load(std::memory_order_acquire))
+			{
+				for (Transform* child : transform->children)
+					CollectRoots(child);
+
+				return;
+			}
+
+			if (transform->collected || (transform->parent && transform->parent->worldDirty.load(std::memory_order_acquire)))
+				return;
+
+			AddRow(transform, NO_PARENT);
+		}
+
+		void UpdateLevel(ThreadPool& threadPool, size_t levelBegin, size_t levelEnd)
+		{
+			size_t count = levelEnd - levelBegin;
+			size_t batchCount = (count + BATCH_SIZE - 1) / BATCH_SIZE;
+
+			threadPool.ParallelForRange(0, batchCount, [this, levelBegin, count](size_t begin, size_t end)
+			{
+				for (size_t batch = begin; batch < end; ++batch)
+				{
+					size_t offset = batch * BATCH_SIZE;
+					UpdateBatch(levelBegin + offset, std::min(BATCH_SIZE, count - offset));
+				}
+			}, BATCHES_PER_TASK);
+		}
+
+		void UpdateBatch(size_t first, size_t count)
+		{
+			using namespace DirectX;
+
+			size_t rows[BATCH_SIZE];
+
+			for (size_t lane = 0; lane < BATCH_SIZE; ++lane)
+				rows[lane] = first + (lane < count ? lane : 0);
+
+			const Vector3f* position = &positions[0];
+			const Vector3f* rotation = &rotations[0];
+			const Vector3f* scale = &scales[0];
+
+			XMVECTOR sinPitch, cosPitch, sinYaw, cosYaw, sinRoll, cosRoll;
+
+			XMVectorSinCos(&sinPitch, &cosPitch, XMVectorSet(rotation[rows[0]].x, rotation[rows[1]].x, rotation[rows[2]].x, rotation[rows[3]].x));
+			XMVectorSinCos(&sinYaw, &cosYaw, XMVectorSet(rotation[rows[0]].y, rotation[rows[1]].y, rotation[rows[2]].y, rotation[rows[3]].y));
+			XMVectorSinCos(&sinRoll, &cosRoll, XMVectorSet(rotation[rows[0]].z, rotation[rows[1]].z, rotation[rows[2]].z, rotation[rows[3]].z));
+
+			XMVECTOR scaleX = XMVectorSet(scale[rows[0]].x, scale[rows[1]].x, scale[rows[2]].x, scale[rows[3]].x);
+			XMVECTOR scaleY = XMVectorSet(scale[rows[0]].y, scale[rows[1]].y, scale[rows[2]].y, scale[rows[3]].y);
+			XMVECTOR scaleZ = XMVectorSet(scale[rows[0]].z, scale[rows[1]].z, scale[rows[2]].z, scale[rows[3]].z);
+
+			XMVECTOR sinRollSinPitch = XMVectorMultiply(sinRoll, sinPitch);
+			XMVECTOR cosRollSinPitch = XMVectorMultiply(cosRoll, sinPitch);
+
+			XMVECTOR local[4][4];
+
+			local[0][0] = XMVectorMultiply(XMVectorMultiplyAdd(sinRollSinPitch, sinYaw, XMVectorMultiply(cosRoll, cosYaw)), scaleX);
+			local[0][1] = XMVectorMultiply(XMVectorMultiply(sinRoll, cosPitch), scaleX);
+			local[0][2] = XMVectorMultiply(XMVectorNegativeMultiplySubtract(cosRoll, sinYaw, XMVectorMultiply(sinRollSinPitch, cosYaw)), scaleX);
+			local[0][3] = XMVectorZero();
+
+			local[1][0] = XMVectorMultiply(XMVectorNegativeMultiplySubtract(sinRoll, cosYaw, XMVectorMultiply(cosRollSinPitch, sinYaw)), scaleY);
+			local[1][1] = XMVectorMultiply(XMVectorMultiply(cosRoll, cosPitch), scaleY);
+			local[1][2] = XMVectorMultiply(XMVectorMultiplyAdd(cosRollSinPitch, cosYaw, XMVectorMultiply(sinRoll, sinYaw)), scaleY);
+			local[1][3] = XMVectorZero();
+
+			local[2][0] = XMVectorMultiply(XMVectorMultiply(cosPitch, sinYaw), scaleZ);
+			local[2][1] = XMVectorMultiply(XMVectorNegate(sinPitch), scaleZ);
+			local[2][2] = XMVectorMultiply(XMVectorMultiply(cosPitch, cosYaw), scaleZ);
+			local[2][3] = XMVectorZero();
+
+			local[3][0] = XMVectorSet(position[rows[0]].x, position[rows[1]].x, position[rows[2]].x, position[rows[3]].x);
+			local[3][1] = XMVectorSet(position[rows[0]].y, position[rows[1]].y, position[rows[2]].y, position[rows[3]].y);
+			local[3][2] = XMVectorSet(position[rows[0]].z, position[rows[1]].z, position[rows[2]].z, position[rows[3]].z);
+			local[3][3] = XMVectorSplatOne();
+
+			const Matrix* parents[BATCH_SIZE];
+
+			for (size_t lane = 0; lane < BATCH_SIZE; ++lane)
+				parents[lane] = parentRows[rows[lane]] == NO_PARENT ? &parentMatrices[rows[lane]] : &worldMatrices[parentRows[rows[lane]]];
+
+			XMVECTOR parent[4][4];
+
+			for (size_t row = 0; row < 4; ++row)
+			{
+				Matrix rows = XMMatrixTranspose(Matrix(parents[0]->r[row], parents[1]->r[row], parents[2]->r[row], parents[3]->r[row]));
+
+				for (size_t column = 0; column < 4; ++column)
+					parent[row][column] = rows.r[column];
+			}
+
+			XMVECTOR world[4][4];
+
+			for (size_t row = 0; row < 4; ++row)
+			{
+				for (size_t column = 0; column < 4; ++column)
+				{
+					XMVECTOR value = XMVectorMultiply(local[row][0], parent[0][column]);
+
+					value = XMVectorMultiplyAdd(local[row][1], parent[1][column], value);
+					value = XMVectorMultiplyAdd(local[row][2], parent[2][column], value);
+					value = XMVectorMultiplyAdd(local[row][3], parent[3][column], value);
+
+					world[row][column] = value;
+				}
+			}
+
+			for (size_t row = 0; row < 4; ++row)
+			{
+				Matrix localRows = XMMatrixTranspose(Matrix(local[row][0], local[row][1], local[row][2], local[row][3]));
+				Matrix worldRows = XMMatrixTranspose(Matrix(world[row][0], world[row][1], world[row][2], world[row][3]));
+
+				for (size_t lane = 0; lane < count; ++lane)
+				{
+					localMatrices[rows[lane]].r[row] = localRows.r[lane];
+					worldMatrices[rows[lane]].r[row] = worldRows.r[lane];
+				}
+			}
+
+			for (size_t lane = 0; lane < count; ++lane)
+			{
+				Transform* transform = transforms[rows[lane]];
+
+				transform->StoreMatrices(localMatrices[rows[lane]], worldMatrices[rows[lane]]);
+				transform->collected = false;
+			}
+		}
+
+		static constexpr uint32_t NO_PARENT = ~0u;
+
+		Vector<Transform*> queue;
+
+		Vector<Transform*> transforms;
+		Vector<ECS::Entity> entities;
+		Vector<Vector3f> positions;
+		Vector<Vector3f> rotations;
+		Vector<Vector3f> scales;
+		Vector<uint32_t> parentRows;
+		Vector<Matrix> parentMatrices;
+		Vector<Matrix> localMatrices;
+		Vector<Matrix> worldMatrices;
+
+	};
+}
\ No newline at end of file
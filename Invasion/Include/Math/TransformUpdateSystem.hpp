@@ -0,0 +1,36 @@
+#pragma once
+
+#include "ECS/System.hpp"
+#include "Math/TransformSystem.hpp"
+
+using namespace Invasion::ECS;
+
+namespace Invasion::Math
+{
+	class TransformUpdateSystem : public System
+	{
+
+	public:
+
+		void Update(ThreadPool& threadPool) override
+		{
+			TransformSystem::GetInstance().Update(threadPool);
+		}
+
+		static Shared<TransformUpdateSystem> Create()
+		{
+			class Enabled : public TransformUpdateSystem { };
+
+			return std::make_shared<Enabled>();
+		}
+
+	protected:
+
+		TransformUpdateSystem() : System("TransformUpdate")
+		{
+			Reads<Transform>();
+			Writes<TransformData>();
+		}
+
+	};
+}
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <DirectXMath.h>
+#include "Util/Hash.hpp"
 #include "Util/Typedefs.hpp"
 
 using namespace Invasion::Util;
@@ -170,6 +171,16 @@ namespace Invasion::Math
         int y = 0;
     };
 
+    bool operator==(const Vector2i& lhs, const Vector2i& rhs)
+    {
+        return lhs.x == rhs.x && lhs.y == rhs.y;
+    }
+
+    bool operator!=(const Vector2i& lhs, const Vector2i& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
     class Vector2f
     {
 
@@ -495,4 +506,16 @@ namespace Invasion::Math
         double x = 0.0;
         double y = 0.0;
     };
+}
+
+namespace std
+{
+    template <>
+    struct hash<Invasion::Math::Vector2i>
+    {
+        std::size_t operator()(const Invasion::Math::Vector2i& v) const noexcept
+        {
+            return static_cast<std::size_t>(Invasion::Util::Hash::Mix(Invasion::Util::Hash::Pack(v.x, v.y)));
+        }
+    };
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <DirectXMath.h>
+#include "Util/Hash.hpp"
 #include "Util/Typedefs.hpp"
 
 using namespace Invasion::Util;
@@ -603,7 +604,7 @@ namespace std
     {
         std::size_t operator()(const Invasion::Math::Vector3i& v) const noexcept
         {
-            return ((std::hash<int>()(v.x) ^ (std::hash<int>()(v.y) << 1)) >> 1) ^ (std::hash<int>()(v.z) << 1);
+            return static_cast<std::size_t>(Invasion::Util::Hash::Combine(Invasion::Util::Hash::Pack(v.x, v.y), static_cast<uint32_t>(v.z)));
         }
     };
 }
\ No newline at end of file
@@ -3,6 +3,7 @@
 #include "Core/Window.hpp"
 #include "ECS/GameObject.hpp"
 #include "Math/Transform.hpp"
+#include "Util/SlabAllocator.hpp"
 
 using namespace Invasion::Core;
 using namespace Invasion::ECS;
@@ -46,7 +47,7 @@ namespace Invasion::Render
 		static Shared<Camera> Create(float fieldOfView, float nearPlane, float farPlane)
 		{
 			class Enabled : public Camera { };
-			Shared<Camera> result = std::make_shared<Enabled>();
+			Shared<Camera> result = MakePooled<Enabled>();
 
 			result->fieldOfView = fieldOfView;
 			result->nearPlane = nearPlane;
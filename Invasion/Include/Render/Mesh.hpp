@@ -6,6 +6,7 @@
 #include "Render/Shader.hpp"
 #include "Render/Texture.hpp"	
 #include "Render/Vertex.hpp"
+#include "Util/SlabAllocator.hpp"
 #include "Util/Typedefs.hpp"
 #include "World/TextureAtlas.hpp"
 
@@ -23,6 +24,12 @@ namespace Invasion::Render
 		Matrix world;
 	};
 
+	// Sort key stored by value next to the entity's TransformData, grouping draws by shader and then by texture.
+	struct MeshRenderKey
+	{
+		uint64_t value = 0;
+	};
+
 	class Mesh : public Component
 	{
 
@@ -72,16 +79,58 @@ namespace Invasion::Render
 			if (FAILED(result))
 				Logger_ThrowException("Failed to create index buffer", true);
 
+			bufferMemory.Set(vertexBufferDescription.ByteWidth + indexBufferDescription.ByteWidth);
+
 			if (FAILED(result))
 				Logger_ThrowException("Failed to create sampler state", true);
 		}
 
+		uint64_t ComputeRenderKey() const
+		{
+			Shared<Shader> shader = GetGameObject()->GetComponent<Shader>();
+			Shared<Texture> texture = GetGameObject()->GetComponent<Texture>();
+			Shared<TextureAtlas> textureAtlas = GetGameObject()->GetComponent<TextureAtlas>();
+
+			uint64_t shaderKey = std::hash<const void*>{}(shader.get());
+			uint64_t textureKey = textureAtlas ? std::hash<const void*>{}(textureAtlas.get()) : std::hash<const void*>{}(texture.get());
+
+			return (shaderKey << 32) | (textureKey & 0xFFFFFFFF);
+		}
+
+		void OnAttach(ECS::Entity entity) override
+		{
+			renderKeyDirty.store(false, std::memory_order_relaxed);
+
+			EntityManager::GetInstance().Add(entity, MeshRenderKey{ ComputeRenderKey() });
+		}
+
+		void OnDetach(ECS::Entity entity) override
+		{
+			EntityManager::GetInstance().Remove<MeshRenderKey>(entity);
+		}
+
+		// The key depends on which Shader, Texture or TextureAtlas sits next to the mesh; MeshRenderKeySystem rewrites
+		// the column on its next run.
+		void OnComponentsChanged() override
+		{
+			renderKeyDirty.store(true, std::memory_order_release);
+		}
+
+		bool ConsumeRenderKeyDirty()
+		{
+			return renderKeyDirty.exchange(false, std::memory_order_acq_rel);
+		}
+
 		void Render(Shared<Camera> camera) override
+		{
+			Draw(camera, GetGameObject()->GetTransform()->GetWorldMatrix());
+		}
+
+		void Draw(const Shared<Camera>& camera, const Matrix& worldMatrix)
 		{
 			Shared<Shader> shader = GetGameObject()->GetComponent<Shader>();
 			Shared<Texture> texture = GetGameObject()->GetComponent<Texture>();
 			Shared<TextureAtlas> textureAtlas = GetGameObject()->GetComponent<TextureAtlas>();
-			Shared<Transform> transform = GetGameObject()->GetComponent<Transform>();
 
 			auto context = Renderer::GetInstance().GetContext();
 
@@ -103,7 +152,7 @@ namespace Invasion::Render
 			{ 
 				DirectX::XMMatrixTranspose(camera->GetProjectionMatrix()),
 				DirectX::XMMatrixTranspose(camera->GetViewMatrix()),
-				DirectX::XMMatrixTranspose(transform->GetWorldMatrix()) 
+				DirectX::XMMatrixTranspose(worldMatrix) 
 			}, ShaderType::VERTEX);
 
 			if (textureAtlas)
@@ -114,12 +163,14 @@ namespace Invasion::Render
 			context->DrawIndexed(indices.Length(), 0, 0);
 		}
 
-		void SetVertices(const Vector<Vertex>& vertices)
+		template <typename Allocator>
+		void SetVertices(const Vector<Vertex, Allocator>& vertices)
 		{
 			this->vertices = vertices;
 		}
 
-		void SetIndices(const Vector<unsigned int>& indices)
+		template <typename Allocator>
+		void SetIndices(const Vector<unsigned int, Allocator>& indices)
 		{
 			this->indices = indices;
 		}
@@ -128,12 +179,14 @@ namespace Invasion::Render
 		{
 			vertexBuffer.Reset();
 			indexBuffer.Reset();
+
+			bufferMemory.Set(0);
 		}
 
 		static Shared<Mesh> Create(const String& name, const Vector<Vertex>& vertices, const Vector<unsigned int>& indices)
 		{
 			class Enabled : public Mesh { };
-			Shared<Mesh> result = std::make_shared<Enabled>();
+			Shared<Mesh> result = MakePooled<Enabled>();
 
 			result->name = name;
 			result->vertices = vertices;
@@ -147,11 +200,14 @@ namespace Invasion::Render
 		Mesh() = default;
 
 		String name;
+		Atomic<bool> renderKeyDirty = false;
 
-		Vector<Vertex> vertices;
-		Vector<unsigned int> indices;
+		TrackedVector<Vertex, MemoryTag::RENDER> vertices;
+		TrackedVector<unsigned int, MemoryTag::RENDER> indices;
 
 		ComPtr<ID3D11Buffer> vertexBuffer;
 		ComPtr<ID3D11Buffer> indexBuffer;
+
+		TrackedBytes bufferMemory{ MemoryTag::RENDER };
 	};
 }
\ No newline at end of file
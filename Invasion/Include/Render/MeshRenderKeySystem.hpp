@@ -0,0 +1,41 @@
+#pragma once
+
+#include "ECS/EntityManager.hpp"
+#include "ECS/System.hpp"
+#include "Render/Mesh.hpp"
+
+using namespace Invasion::ECS;
+
+namespace Invasion::Render
+{
+	class MeshRenderKeySystem : public System
+	{
+
+	public:
+
+		void Update(ThreadPool& threadPool) override
+		{
+			EntityManager::GetInstance().ParallelForEach<ComponentReference<Mesh>, MeshRenderKey>(threadPool, [](ECS::Entity, ComponentReference<Mesh>& mesh, MeshRenderKey& key)
+			{
+				if (mesh.component->ConsumeRenderKeyDirty())
+					key.value = mesh.component->ComputeRenderKey();
+			});
+		}
+
+		static Shared<MeshRenderKeySystem> Create()
+		{
+			class Enabled : public MeshRenderKeySystem { };
+
+			return std::make_shared<Enabled>();
+		}
+
+	protected:
+
+		MeshRenderKeySystem() : System("MeshRenderKey")
+		{
+			Reads<ComponentReference<Mesh>>();
+			Writes<MeshRenderKey>();
+		}
+
+	};
+}
\ No newline at end of file
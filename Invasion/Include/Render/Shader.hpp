@@ -284,9 +284,9 @@ namespace Invasion::Render
 			return domain;
 		}
 
-		UnorderedMap<String, String> GetPaths() const
+		UnorderedMap<String, String, NoLock> GetPaths() const
 		{
-			UnorderedMap<String, String> result;
+			UnorderedMap<String, String, NoLock> result;
 
 			result["vertex"] = vertexPath;
 			result["pixel"] = pixelPath;
@@ -400,7 +400,7 @@ namespace Invasion::Render
 
 		ComPtr<ID3D11InputLayout> inputLayout;
 
-		UnorderedMap<uint32_t, ComPtr<ID3D11Buffer>> constantBuffers;
+		UnorderedMap<uint32_t, ComPtr<ID3D11Buffer>, NoLock> constantBuffers;
 	};
 
 }
\ No newline at end of file
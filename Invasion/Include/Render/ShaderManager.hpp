@@ -17,12 +17,12 @@ namespace Invasion::Render
 			registeredShaders += { shader->GetName(), shader };
 		}
 
-		Shared<Shader> Get(const String& name)
+		Shared<Shader> Get(StringId name)
 		{
 			return registeredShaders[name];
 		}
 
-		void Unregister(const String& name)
+		void Unregister(StringId name)
 		{
 			registeredShaders -= name;
 		}
@@ -44,7 +44,7 @@ namespace Invasion::Render
 
 		ShaderManager() = default;
 
-		UnorderedMap<String, Shared<Shader>> registeredShaders;
+		FlatMap<StringId, Shared<Shader>, SharedMutexLock> registeredShaders;
 
 	};
 }
\ No newline at end of file
@@ -72,6 +72,8 @@ namespace Invasion
 				shaderResourceView.Reset();
 				texture.Reset();
 				samplerState.Reset();
+
+				residentMemory.Set(0);
 			}
 
 			static Shared<Texture> Create(const String& name, const String& localPath, D3D11_SAMPLER_DESC samplerDescription, const String& domain = Settings::GetInstance().Get<String>("defaultDomain"))
@@ -109,6 +111,8 @@ namespace Invasion
 
 				if (FAILED(result))
 					Logger_ThrowException("Failed to create texture from image", true);
+
+				residentMemory.Set(image.GetPixelsSize());
 				
 				D3D11_SHADER_RESOURCE_VIEW_DESC shaderResourceViewDescription = {};
 
@@ -143,6 +147,8 @@ namespace Invasion
 			ComPtr<ID3D11ShaderResourceView> shaderResourceView;
 			ComPtr<ID3D11SamplerState> samplerState;
 
+			TrackedBytes residentMemory{ MemoryTag::ASSETS };
+
 		};
 	}
 }
\ No newline at end of file
@@ -17,12 +17,12 @@ namespace Invasion::Render
 			registeredTextures += { texture->GetName(), texture };
 		}
 
-		Shared<Texture> Get(const String& name)
+		Shared<Texture> Get(StringId name)
 		{
 			return registeredTextures[name];
 		}
 
-		void Unregister(const String& name)
+		void Unregister(StringId name)
 		{
 			registeredTextures -= name;
 		}
@@ -44,7 +44,7 @@ namespace Invasion::Render
 
 		TextureManager() = default;
 
-		UnorderedMap<String, Shared<Texture>> registeredTextures;
+		FlatMap<StringId, Shared<Texture>, SharedMutexLock> registeredTextures;
 
 	};
 }
\ No newline at end of file
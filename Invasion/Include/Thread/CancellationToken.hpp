@@ -0,0 +1,55 @@
+#pragma once
+
+#include "Util/Typedefs.hpp"
+
+using namespace Invasion::Util;
+
+namespace Invasion::Thread
+{
+    class TaskCancelledException : public std::runtime_error
+    {
+
+    public:
+
+        TaskCancelledException() : std::runtime_error("Task was cancelled before it started.") { }
+
+    };
+
+    class CancellationToken
+    {
+
+    public:
+
+        CancellationToken() = default;
+
+        void Cancel()
+        {
+            if (state)
+                state->store(true, std::memory_order_release);
+        }
+
+        bool IsCancelled() const
+        {
+            return state && state->load(std::memory_order_acquire);
+        }
+
+        bool IsValid() const
+        {
+            return state != nullptr;
+        }
+
+        static CancellationToken Create()
+        {
+            CancellationToken result;
+
+            result.state = std::make_shared<Atomic<bool>>(false);
+
+            return result;
+        }
+
+    private:
+
+        Shared<Atomic<bool>> state;
+
+    };
+}
\ No newline at end of file
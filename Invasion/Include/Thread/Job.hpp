@@ -0,0 +1,290 @@
+#pragma once
+
+#include "Thread/ThreadPool.hpp"
+#include "Util/Typedefs.hpp"
+
+using namespace Invasion::Util;
+
+namespace Invasion::Thread
+{
+    class JobCounter
+    {
+
+    public:
+
+        JobCounter(const JobCounter&) = delete;
+        JobCounter& operator=(const JobCounter&) = delete;
+
+        void Increment()
+        {
+            value.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        void Decrement()
+        {
+            if (value.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                value.notify_all();
+        }
+
+        size_t GetValue() const
+        {
+            return value.load(std::memory_order_acquire);
+        }
+
+        bool IsZero() const
+        {
+            return GetValue() == 0;
+        }
+
+        void Wait() const
+        {
+            size_t current = value.load(std::memory_order_acquire);
+
+            while (current != 0)
+            {
+                value.wait(current, std::memory_order_acquire);
+                current = value.load(std::memory_order_acquire);
+            }
+        }
+
+        static Shared<JobCounter> Create()
+        {
+            class Enabled : public JobCounter { };
+
+            return std::make_shared<Enabled>();
+        }
+
+    private:
+
+        JobCounter() = default;
+
+        Atomic<size_t> value = 0;
+
+    };
+
+    class Job : public std::enable_shared_from_this<Job>
+    {
+
+    public:
+
+        Job(const Job&) = delete;
+        Job& operator=(const Job&) = delete;
+
+        void DependsOn(const Shared<Job>& dependency)
+        {
+            assert(!submitted && "Dependencies must be added before the job is submitted");
+
+            pendingDependencies.fetch_add(1, std::memory_order_relaxed);
+
+            if (!dependency->AddContinuation(shared_from_this()))
+            {
+                RecordDependencyException(dependency->GetException());
+                pendingDependencies.fetch_sub(1, std::memory_order_relaxed);
+            }
+        }
+
+        void Submit(Shared<JobCounter> counter = nullptr)
+        {
+            assert(!submitted && "A job can only be submitted once");
+
+            submitted = true;
+
+            if (counter)
+            {
+                counter->Increment();
+                this->counter = std::move(counter);
+            }
+
+            ReleaseDependency();
+        }
+
+        Shared<Job> Then(Function<void()> function, TaskPriority priority = TaskPriority::NORMAL)
+        {
+            Shared<Job> continuation = Create(*pool, std::move(function), priority, token);
+
+            continuation->DependsOn(shared_from_this());
+            continuation->Submit();
+
+            return continuation;
+        }
+
+        bool IsComplete() const
+        {
+            return complete.load(std::memory_order_acquire);
+        }
+
+        bool WasCancelled() const
+        {
+            return cancelled;
+        }
+
+        // A job still runs when one of its dependencies failed, but inherits the first dependency exception so that
+        // failures surface through WhenAll and Then chains. Only meaningful once the job is complete.
+        std::exception_ptr GetException() const
+        {
+            return exception;
+        }
+
+        void Wait() const
+        {
+            complete.wait(false, std::memory_order_acquire);
+        }
+
+        static Shared<Job> Create(ThreadPool& pool, Function<void()> function, TaskPriority priority = TaskPriority::NORMAL, CancellationToken token = {}, const char* tag = "Job")
+        {
+            class Enabled : public Job { };
+            Shared<Job> result = std::make_shared<Enabled>();
+
+            result->pool = &pool;
+            result->function = std::move(function);
+            result->priority = priority;
+            result->token = std::move(token);
+            result->tag = tag;
+
+            return std::move(result);
+        }
+
+        template <typename Allocator>
+        static Shared<Job> WhenAll(ThreadPool& pool, const Vector<Shared<Job>, Allocator>& jobs, TaskPriority priority = TaskPriority::CRITICAL)
+        {
+            Shared<Job> result = Create(pool, [] { }, priority);
+
+            for (const Shared<Job>& job : jobs)
+                result->DependsOn(job);
+
+            result->Submit();
+
+            return std::move(result);
+        }
+
+        static Shared<Job> WhenAny(ThreadPool& pool, const Vector<Shared<Job>>& jobs, TaskPriority priority = TaskPriority::CRITICAL)
+        {
+            Shared<Job> result = Create(pool, [] { }, priority);
+
+            result->waitForAny = true;
+            result->pendingDependencies.fetch_add(1, std::memory_order_relaxed);
+
+            for (const Shared<Job>& job : jobs)
+            {
+                if (!job->AddContinuation(result))
+                    result->ReleaseAnyDependency(job->GetException());
+            }
+
+            if (jobs.IsEmpty())
+                result->ReleaseAnyDependency(nullptr);
+
+            result->Submit();
+
+            return std::move(result);
+        }
+
+    private:
+
+        Job() = default;
+
+        bool AddContinuation(Shared<Job> continuation)
+        {
+            LockGuard<Mutex> lock(mutex);
+
+            if (IsComplete())
+                return false;
+
+            continuations += continuation;
+
+            return true;
+        }
+
+        void OnDependencyComplete(const std::exception_ptr& dependencyException)
+        {
+            if (waitForAny)
+                ReleaseAnyDependency(dependencyException);
+            else
+            {
+                RecordDependencyException(dependencyException);
+                ReleaseDependency();
+            }
+        }
+
+        void ReleaseAnyDependency(const std::exception_ptr& dependencyException)
+        {
+            if (!anyReleased.exchange(true, std::memory_order_acq_rel))
+            {
+                exception = dependencyException;
+                ReleaseDependency();
+            }
+        }
+
+        void RecordDependencyException(const std::exception_ptr& dependencyException)
+        {
+            if (!dependencyException)
+                return;
+
+            LockGuard<Mutex> lock(mutex);
+
+            if (!exception)
+                exception = dependencyException;
+        }
+
+        void ReleaseDependency()
+        {
+            if (pendingDependencies.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                pool->Dispatch([self = shared_from_this()] { self->Execute(); }, priority, {}, tag);
+        }
+
+        void Execute()
+        {
+            if (token.IsCancelled())
+                cancelled = true;
+            else
+            {
+                try
+                {
+                    function();
+                }
+                catch (...)
+                {
+                    if (!exception)
+                        exception = std::current_exception();
+                }
+            }
+
+            function = nullptr;
+
+            SmallVector<Shared<Job>, 4> ready;
+
+            {
+                LockGuard<Mutex> lock(mutex);
+
+                complete.store(true, std::memory_order_release);
+                ready.Swap(continuations);
+            }
+
+            complete.notify_all();
+
+            if (counter)
+                counter->Decrement();
+
+            for (Shared<Job>& continuation : ready)
+                continuation->OnDependencyComplete(exception);
+        }
+
+        ThreadPool* pool = nullptr;
+        Function<void()> function;
+        TaskPriority priority = TaskPriority::NORMAL;
+        CancellationToken token;
+        const char* tag = "Job";
+        Shared<JobCounter> counter;
+
+        Atomic<size_t> pendingDependencies = 1;
+        Atomic<bool> anyReleased = false;
+        Atomic<bool> complete = false;
+        bool waitForAny = false;
+        bool submitted = false;
+        bool cancelled = false;
+        std::exception_ptr exception;
+
+        Mutex mutex;
+        SmallVector<Shared<Job>, 4> continuations;
+
+    };
+}
\ No newline at end of file
@@ -0,0 +1,127 @@
+#pragma once
+
+#include "Thread/CancellationToken.hpp"
+#include "Thread/Task.hpp"
+#include "Thread/TaskFunction.hpp"
+#include "Util/Typedefs.hpp"
+
+using namespace Invasion::Util;
+
+namespace Invasion::Thread
+{
+    class MainThreadDispatcher
+    {
+
+    public:
+
+        MainThreadDispatcher(const MainThreadDispatcher&) = delete;
+        MainThreadDispatcher& operator=(const MainThreadDispatcher&) = delete;
+
+        template <typename T>
+        void Post(T task)
+        {
+            {
+                LockGuard<Mutex> lock(mutex);
+                pending |= TaskFunction{ std::move(task) };
+            }
+
+            eventVar.notify_one();
+        }
+
+        auto Schedule()
+        {
+            struct Awaiter
+            {
+                MainThreadDispatcher* dispatcher;
+                bool dropped = false;
+
+                bool await_ready() const noexcept
+                {
+                    return false;
+                }
+
+                void await_suspend(std::coroutine_handle<> handle)
+                {
+                    dispatcher->Post(ScheduledResume{ handle, dropped });
+                }
+
+                void await_resume() const
+                {
+                    if (dropped)
+                        throw TaskCancelledException();
+                }
+            };
+
+            return Awaiter{ this };
+        }
+
+        void Execute()
+        {
+            {
+                LockGuard<Mutex> lock(mutex);
+                executing.Swap(pending);
+            }
+
+            for (TaskFunction& task : executing)
+                task();
+
+            executing.Clear();
+        }
+
+        // Runs posted work on the calling thread until the task completes. Task::Wait would deadlock on the main thread
+        // once the task hops back to it, since nothing else drains this queue. A task that finishes on a worker posts
+        // nothing, so the wait also times out briefly to recheck it.
+        template <typename T>
+        T RunUntilComplete(Task<T>& task)
+        {
+            while (true)
+            {
+                Execute();
+
+                if (task.IsReady())
+                    return task.GetResult();
+
+                std::unique_lock<Mutex> lock(mutex);
+                eventVar.wait_for(lock, COMPLETION_POLL_INTERVAL, [this, &task] { return !pending.IsEmpty() || task.IsReady(); });
+            }
+        }
+
+        // Drops everything still queued. Coroutines waiting for a main-thread hop resume as cancelled, on this thread,
+        // rather than staying suspended forever; anything they post while unwinding is dropped too.
+        void CleanUp()
+        {
+            while (true)
+            {
+                Vector<TaskFunction> dropped;
+
+                {
+                    LockGuard<Mutex> lock(mutex);
+                    dropped.Swap(pending);
+                }
+
+                if (dropped.IsEmpty())
+                    return;
+
+                dropped.Clear();
+            }
+        }
+
+        static MainThreadDispatcher& GetInstance()
+        {
+            static MainThreadDispatcher instance;
+            return instance;
+        }
+
+    private:
+
+        MainThreadDispatcher() = default;
+
+        static constexpr std::chrono::milliseconds COMPLETION_POLL_INTERVAL{ 1 };
+
+        Mutex mutex;
+        ConditionVariable eventVar;
+        Vector<TaskFunction> pending;
+        Vector<TaskFunction> executing;
+
+    };
+}
\ No newline at end of file
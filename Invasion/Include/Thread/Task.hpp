@@ -0,0 +1,290 @@
+#pragma once
+
+#include <utility>
+#include "Util/Typedefs.hpp"
+
+using namespace Invasion::Util;
+
+namespace Invasion::Thread
+{
+    template <typename T = void>
+    class Task;
+
+    class TaskPromiseBase
+    {
+
+    public:
+
+        struct FinalAwaiter
+        {
+            bool await_ready() const noexcept
+            {
+                return false;
+            }
+
+            template <typename P>
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<P> handle) noexcept
+            {
+                TaskPromiseBase& promise = handle.promise();
+                std::coroutine_handle<> continuation = promise.continuation;
+
+                if (promise.detached)
+                {
+                    handle.destroy();
+                    return std::noop_coroutine();
+                }
+
+                promise.completed.store(true, std::memory_order_release);
+                promise.completed.notify_all();
+
+                return continuation ? continuation : std::noop_coroutine();
+            }
+
+            void await_resume() const noexcept { }
+        };
+
+        std::suspend_always initial_suspend() const noexcept
+        {
+            return {};
+        }
+
+        FinalAwaiter final_suspend() const noexcept
+        {
+            return {};
+        }
+
+        void unhandled_exception()
+        {
+            exception = std::current_exception();
+        }
+
+        std::coroutine_handle<> continuation;
+        std::exception_ptr exception;
+        Atomic<bool> completed = false;
+        bool detached = false;
+
+    };
+
+    template <typename T>
+    class TaskPromise : public TaskPromiseBase
+    {
+
+    public:
+
+        Task<T> get_return_object();
+
+        template <typename U>
+        void return_value(U&& value)
+        {
+            result.emplace(std::forward<U>(value));
+        }
+
+        T TakeResult()
+        {
+            if (exception)
+                std::rethrow_exception(exception);
+
+            return std::move(*result);
+        }
+
+    private:
+
+        Optional<T> result;
+
+    };
+
+    template <>
+    class TaskPromise<void> : public TaskPromiseBase
+    {
+
+    public:
+
+        Task<void> get_return_object();
+
+        void return_void() const noexcept { }
+
+        void TakeResult()
+        {
+            if (exception)
+                std::rethrow_exception(exception);
+        }
+
+    };
+
+    template <typename T>
+    class Task
+    {
+
+    public:
+
+        using promise_type = TaskPromise<T>;
+        using Handle = std::coroutine_handle<promise_type>;
+
+        Task() = default;
+
+        explicit Task(Handle handle) : handle(handle) { }
+
+        Task(const Task&) = delete;
+        Task& operator=(const Task&) = delete;
+
+        Task(Task&& other) noexcept : handle(std::exchange(other.handle, nullptr)), started(other.started) { }
+
+        Task& operator=(Task&& other) noexcept
+        {
+            if (this != &other)
+            {
+                Reset();
+                handle = std::exchange(other.handle, nullptr);
+                started = other.started;
+            }
+
+            return *this;
+        }
+
+        ~Task()
+        {
+            Reset();
+        }
+
+        auto operator co_await() && noexcept
+        {
+            struct Awaiter
+            {
+                Handle handle;
+
+                bool await_ready() const noexcept
+                {
+                    return !handle;
+                }
+
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept
+                {
+                    handle.promise().continuation = awaiting;
+                    return handle;
+                }
+
+                T await_resume()
+                {
+                    return handle.promise().TakeResult();
+                }
+            };
+
+            assert(!started && "A started task cannot be awaited");
+
+            started = true;
+
+            return Awaiter{ handle };
+        }
+
+        auto operator co_await() & noexcept
+        {
+            return std::move(*this).operator co_await();
+        }
+
+        void Start()
+        {
+            assert(handle && !started && "Task is empty or already started");
+
+            started = true;
+            handle.resume();
+        }
+
+        void Detach()
+        {
+            assert(handle && !started && "Task is empty or already started");
+
+            Handle detachedHandle = std::exchange(handle, nullptr);
+
+            detachedHandle.promise().detached = true;
+            detachedHandle.resume();
+        }
+
+        bool IsValid() const
+        {
+            return handle != nullptr;
+        }
+
+        bool IsReady() const
+        {
+            return handle && handle.promise().completed.load(std::memory_order_acquire);
+        }
+
+        void Wait() const
+        {
+            handle.promise().completed.wait(false, std::memory_order_acquire);
+        }
+
+        T GetResult()
+        {
+            assert(IsReady() && "Task has not completed");
+
+            return handle.promise().TakeResult();
+        }
+
+    private:
+
+        void Reset()
+        {
+            if (handle)
+            {
+                assert((!started || handle.promise().completed.load()) && "A running task must not be destroyed");
+
+                handle.destroy();
+                handle = nullptr;
+            }
+        }
+
+        Handle handle = nullptr;
+        bool started = false;
+
+    };
+
+    template <typename T>
+    Task<T> TaskPromise<T>::get_return_object()
+    {
+        return Task<T>{ Task<T>::Handle::from_promise(*this) };
+    }
+
+    inline Task<void> TaskPromise<void>::get_return_object()
+    {
+        return Task<void>{ Task<void>::Handle::from_promise(*this) };
+    }
+
+    // A suspended coroutine waiting in a ThreadPool or MainThreadDispatcher queue. Running it resumes the coroutine.
+    // Dropping it unrun, because the queue was discarded at shutdown, resumes the coroutine with the dropped flag set
+    // so its awaiter throws TaskCancelledException and the frame unwinds instead of leaking.
+    class ScheduledResume
+    {
+
+    public:
+
+        ScheduledResume(std::coroutine_handle<> handle, bool& dropped) : handle(handle), dropped(&dropped) { }
+
+        ScheduledResume(const ScheduledResume&) = delete;
+        ScheduledResume& operator=(const ScheduledResume&) = delete;
+
+        ScheduledResume(ScheduledResume&& other) noexcept : handle(std::exchange(other.handle, nullptr)), dropped(other.dropped) { }
+
+        ScheduledResume& operator=(ScheduledResume&&) = delete;
+
+        ~ScheduledResume()
+        {
+            if (handle)
+            {
+                *dropped = true;
+                std::exchange(handle, nullptr).resume();
+            }
+        }
+
+        void operator()()
+        {
+            std::exchange(handle, nullptr).resume();
+        }
+
+    private:
+
+        std::coroutine_handle<> handle;
+        bool* dropped;
+
+    };
+}
\ No newline at end of file
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include "Util/Typedefs.hpp"
+
+using namespace Invasion::Util;
+
+namespace Invasion::Thread
+{
+    class TaskFunction
+    {
+
+    public:
+
+        TaskFunction() = default;
+
+        template <typename F, typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, TaskFunction>>>
+        TaskFunction(F&& function)
+        {
+            using Callable = std::decay_t<F>;
+
+            if constexpr (IsStoredInline<Callable>())
+            {
+                new (storage) Callable(std::forward<F>(function));
+                operations = &InlineOperations<Callable>;
+            }
+            else
+            {
+                *reinterpret_cast<Callable**>(storage) = new Callable(std::forward<F>(function));
+                operations = &HeapOperations<Callable>;
+            }
+        }
+
+        TaskFunction(const TaskFunction&) = delete;
+        TaskFunction& operator=(const TaskFunction&) = delete;
+
+        TaskFunction(TaskFunction&& other) noexcept
+        {
+            MoveFrom(other);
+        }
+
+        TaskFunction& operator=(TaskFunction&& other) noexcept
+        {
+            if (this != &other)
+            {
+                Reset();
+                MoveFrom(other);
+            }
+
+            return *this;
+        }
+
+        TaskFunction& operator=(std::nullptr_t) noexcept
+        {
+            Reset();
+            return *this;
+        }
+
+        ~TaskFunction()
+        {
+            Reset();
+        }
+
+        void operator()()
+        {
+            operations->invoke(storage);
+        }
+
+        explicit operator bool() const
+        {
+            return operations != nullptr;
+        }
+
+        void Reset() noexcept
+        {
+            if (operations)
+            {
+                operations->destroy(storage);
+                operations = nullptr;
+            }
+        }
+
+        static constexpr size_t INLINE_CAPACITY = 64;
+
+    private:
+
+        struct Operations
+        {
+            void (*invoke)(void*);
+            void (*move)(void*, void*);
+            void (*destroy)(void*);
+        };
+
+        template <typename Callable>
+        static constexpr bool IsStoredInline()
+        {
+            return sizeof(Callable) <= INLINE_CAPACITY && alignof(Callable) <= alignof(std::max_align_t) && std::is_nothrow_move_constructible_v<Callable>;
+        }
+
+        template <typename Callable>
+        static constexpr Operations InlineOperations =
+        {
+            [](void* storage) { (*std::launder(reinterpret_cast<Callable*>(storage)))(); },
+            [](void* destination, void* source)
+            {
+                Callable* callable = std::launder(reinterpret_cast<Callable*>(source));
+
+                new (destination) Callable(std::move(*callable));
+                callable->~Callable();
+            },
+            [](void* storage) { std::launder(reinterpret_cast<Callable*>(storage))->~Callable(); }
+        };
+
+        template <typename Callable>
+        static constexpr Operations HeapOperations =
+        {
+            [](void* storage) { (**reinterpret_cast<Callable**>(storage))(); },
+            [](void* destination, void* source) { *reinterpret_cast<Callable**>(destination) = *reinterpret_cast<Callable**>(source); },
+            [](void* storage) { delete *reinterpret_cast<Callable**>(storage); }
+        };
+
+        void MoveFrom(TaskFunction& other) noexcept
+        {
+            if (other.operations)
+            {
+                other.operations->move(storage, other.storage);
+                operations = other.operations;
+                other.operations = nullptr;
+            }
+        }
+
+        alignas(std::max_align_t) unsigned char storage[INLINE_CAPACITY];
+        const Operations* operations = nullptr;
+
+    };
+}
\ No newline at end of file
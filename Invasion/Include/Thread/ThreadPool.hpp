@@ -1,17 +1,31 @@
 #pragma once
 
+#include "Core/Logger.hpp"
+#include "Thread/CancellationToken.hpp"
+#include "Thread/Task.hpp"
+#include "Thread/TaskFunction.hpp"
+#include "Thread/ThreadPoolStatistics.hpp"
+#include "Util/PoolAllocator.hpp"
 #include "Util/Typedefs.hpp"
 
+using namespace Invasion::Core;
 using namespace Invasion::Util;
 
 namespace Invasion::Thread
 {
+    enum class TaskPriority
+    {
+        CRITICAL,
+        NORMAL,
+        BACKGROUND
+    };
+
     class ThreadPool
     {
 
     public:
 
-        ThreadPool(size_t numThreads)
+        ThreadPool(size_t numThreads) : statistics(numThreads)
         {
             Start(numThreads);
         }
@@ -24,50 +38,439 @@ namespace Invasion::Thread
         template<typename T>
         auto operator+=(T task) -> Future<decltype(task())>
         {
-            auto wrapper = std::make_shared<std::packaged_task<decltype(task())()>>(std::move(task));
+            return Submit(std::move(task), TaskPriority::NORMAL);
+        }
+
+        template<typename T>
+        auto Submit(T task, TaskPriority priority, CancellationToken token = {}, const char* tag = "untagged") -> Future<decltype(task())>
+        {
+            using Result = decltype(task());
+
+            Promise<Result> promise{ std::allocator_arg, PoolAllocator<Result>() };
+            Future<Result> future = promise.get_future();
+
+            Enqueue([task = std::move(task), token = std::move(token), promise = std::move(promise)]() mutable
+            {
+                if (token.IsCancelled())
+                {
+                    promise.set_exception(std::make_exception_ptr(TaskCancelledException()));
+                    return;
+                }
+
+                try
+                {
+                    if constexpr (std::is_void_v<Result>)
+                    {
+                        task();
+                        promise.set_value();
+                    }
+                    else
+                        promise.set_value(task());
+                }
+                catch (...)
+                {
+                    promise.set_exception(std::current_exception());
+                }
+            }, priority, tag);
+
+            return future;
+        }
+
+        template<typename T>
+        void Dispatch(T task, TaskPriority priority = TaskPriority::NORMAL, CancellationToken token = {}, const char* tag = "untagged")
+        {
+            Enqueue([task = std::move(task), token = std::move(token)]() mutable
+            {
+                if (token.IsCancelled())
+                    return;
+
+                try
+                {
+                    task();
+                }
+                catch (const std::exception& e)
+                {
+                    Logger_WriteConsole(std::string("Exception in dispatched task: ") + e.what(), LogLevel::ERROR);
+                }
+                catch (...)
+                {
+                    Logger_WriteConsole("Unknown exception in dispatched task", LogLevel::ERROR);
+                }
+            }, priority, tag);
+        }
+
+        auto Schedule(TaskPriority priority = TaskPriority::NORMAL, CancellationToken token = {})
+        {
+            struct Awaiter
+            {
+                ThreadPool* pool;
+                TaskPriority priority;
+                CancellationToken token;
+                bool dropped = false;
+
+                bool await_ready() const noexcept
+                {
+                    return false;
+                }
+
+                void await_suspend(std::coroutine_handle<> handle)
+                {
+                    pool->Dispatch(ScheduledResume{ handle, dropped }, priority, {}, "Coroutine");
+                }
+
+                void await_resume() const
+                {
+                    if (dropped || token.IsCancelled())
+                        throw TaskCancelledException();
+                }
+            };
+
+            return Awaiter{ this, priority, std::move(token) };
+        }
+
+        template<typename F>
+        void ParallelForRange(size_t begin, size_t end, F&& function, size_t grainSize = 0)
+        {
+            if (end <= begin)
+                return;
+
+            size_t count = end - begin;
+            size_t grain = grainSize != 0 ? grainSize : GetAdaptiveGrainSize(count);
+            size_t chunkCount = (count + grain - 1) / grain;
+
+            if (chunkCount <= 1 || threads.empty())
+            {
+                function(begin, end);
+                return;
+            }
+
+            auto state = std::allocate_shared<ParallelState>(PoolAllocator<ParallelState>());
+            auto* callable = &function;
+
+            size_t helperCount = std::min(threads.size(), chunkCount - 1);
+
+            for (size_t i = 0; i < helperCount; ++i)
+                Dispatch([this, state, callable, begin, end, grain, chunkCount] { RunChunks(*state, *callable, begin, end, grain, chunkCount, true); }, TaskPriority::CRITICAL, {}, "ParallelFor");
+
+            RunChunks(*state, function, begin, end, grain, chunkCount, false);
+
+            size_t completed = state->completedChunks.load(std::memory_order_acquire);
+
+            while (completed != chunkCount)
+            {
+                state->completedChunks.wait(completed, std::memory_order_acquire);
+                completed = state->completedChunks.load(std::memory_order_acquire);
+            }
+
+            if (state->exception)
+                std::rethrow_exception(state->exception);
+        }
+
+        template<typename F>
+        void ParallelFor(size_t begin, size_t end, F&& function, size_t grainSize = 0)
+        {
+            ParallelForRange(begin, end, [&function](size_t rangeBegin, size_t rangeEnd)
+            {
+                for (size_t i = rangeBegin; i < rangeEnd; ++i)
+                    function(i);
+            }, grainSize);
+        }
+
+        template<typename T, typename F>
+        void ParallelForEach(Vector<T>& vector, F&& function, size_t grainSize = 0)
+        {
+            ParallelForRange(0, vector.Length(), [&vector, &function](size_t rangeBegin, size_t rangeEnd)
+            {
+                for (size_t i = rangeBegin; i < rangeEnd; ++i)
+                    function(vector[i]);
+            }, grainSize);
+        }
+
+        template<typename R, typename M, typename C>
+        R ParallelReduce(size_t begin, size_t end, R identity, M&& map, C&& combine, size_t grainSize = 0)
+        {
+            if (end <= begin)
+                return identity;
+
+            size_t count = end - begin;
+            size_t grain = grainSize != 0 ? grainSize : GetAdaptiveGrainSize(count);
+            size_t chunkCount = (count + grain - 1) / grain;
+
+            Vector<R> partials;
+            partials.Resize(chunkCount);
+
+            ParallelForRange(begin, end, [&](size_t rangeBegin, size_t rangeEnd)
+            {
+                R partial = identity;
+
+                for (size_t i = rangeBegin; i < rangeEnd; ++i)
+                    partial = combine(std::move(partial), map(i));
+
+                partials[(rangeBegin - begin) / grain] = std::move(partial);
+            }, grain);
+
+            R result = std::move(identity);
+
+            for (R& partial : partials)
+                result = combine(std::move(result), std::move(partial));
+
+            return result;
+        }
+
+        template<typename T, typename C = std::less<>>
+        void ParallelSort(Vector<T>& vector, C compare = C{})
+        {
+            size_t count = vector.Length();
+
+            if (count < PARALLEL_SORT_THRESHOLD || threads.empty())
+            {
+                std::sort(vector.begin(), vector.end(), compare);
+                return;
+            }
+
+            size_t width = (count + threads.size()) / (threads.size() + 1);
+
+            ParallelForRange(0, count, [&vector, &compare](size_t rangeBegin, size_t rangeEnd)
+            {
+                std::sort(vector.begin() + rangeBegin, vector.begin() + rangeEnd, compare);
+            }, width);
+
+            for (; width < count; width *= 2)
+            {
+                size_t pairCount = (count + 2 * width - 1) / (2 * width);
+
+                ParallelFor(0, pairCount, [&vector, &compare, width, count](size_t pair)
+                {
+                    size_t first = pair * 2 * width;
+                    size_t middle = std::min(first + width, count);
+                    size_t last = std::min(first + 2 * width, count);
+
+                    if (middle < last)
+                        std::inplace_merge(vector.begin() + first, vector.begin() + middle, vector.begin() + last, compare);
+                }, 1);
+            }
+        }
+
+        size_t GetPendingCount(TaskPriority priority) const
+        {
+            std::unique_lock<Mutex> lock{ eventMutex };
+            return tasks[static_cast<size_t>(priority)].Length();
+        }
+
+        ThreadPoolStatisticsSnapshot GetStatistics() const
+        {
+            return statistics.GetSnapshot();
+        }
+
+    private:
+
+        struct QueuedTask
+        {
+            TaskFunction function;
+            const char* tag = nullptr;
+            SteadyClock::time_point enqueueTime;
+        };
+
+        class TaskQueue
+        {
+
+        public:
+
+            void Push(QueuedTask&& task)
+            {
+                if (count == buffer.Length())
+                    Grow();
+
+                buffer[(head + count) % buffer.Length()] = std::move(task);
+                ++count;
+            }
+
+            QueuedTask Pop()
+            {
+                QueuedTask task = std::move(buffer[head]);
+
+                head = (head + 1) % buffer.Length();
+                --count;
+
+                return task;
+            }
+
+            size_t Length() const
+            {
+                return count;
+            }
+
+            bool IsEmpty() const
+            {
+                return count == 0;
+            }
+
+        private:
+
+            void Grow()
+            {
+                Vector<QueuedTask> grown;
+                grown.Resize(buffer.IsEmpty() ? INITIAL_CAPACITY : buffer.Length() * 2);
+
+                for (size_t i = 0; i < count; ++i)
+                    grown[i] = std::move(buffer[(head + i) % buffer.Length()]);
+
+                buffer.Swap(grown);
+                head = 0;
+            }
+
+            static constexpr size_t INITIAL_CAPACITY = 64;
+
+            Vector<QueuedTask> buffer;
+            size_t head = 0;
+            size_t count = 0;
+
+        };
+
+        struct ParallelState
+        {
+            Atomic<size_t> nextChunk = 0;
+            Atomic<size_t> completedChunks = 0;
+            Mutex exceptionMutex;
+            std::exception_ptr exception;
+        };
+
+        template<typename F>
+        void RunChunks(ParallelState& state, F& function, size_t begin, size_t end, size_t grain, size_t chunkCount, bool helper)
+        {
+            while (true)
+            {
+                size_t chunk = state.nextChunk.fetch_add(1, std::memory_order_relaxed);
+
+                if (chunk >= chunkCount)
+                    return;
+
+                if (helper)
+                    statistics.RecordHelpedChunk(workerIndex);
+
+                size_t rangeBegin = begin + chunk * grain;
+                size_t rangeEnd = std::min(rangeBegin + grain, end);
+
+                try
+                {
+                    function(rangeBegin, rangeEnd);
+                }
+                catch (...)
+                {
+                    LockGuard<Mutex> lock(state.exceptionMutex);
+
+                    if (!state.exception)
+                        state.exception = std::current_exception();
+                }
+
+                if (state.completedChunks.fetch_add(1, std::memory_order_acq_rel) + 1 == chunkCount)
+                    state.completedChunks.notify_all();
+            }
+        }
+
+        size_t GetAdaptiveGrainSize(size_t count) const
+        {
+            size_t targetChunks = (threads.size() + 1) * CHUNKS_PER_THREAD;
+
+            return std::max<size_t>(1, (count + targetChunks - 1) / targetChunks);
+        }
+
+        template<typename T>
+        void Enqueue(T&& task, TaskPriority priority, const char* tag)
+        {
+            QueuedTask queued{ TaskFunction{ std::forward<T>(task) }, tag, SteadyClock::now() };
+            size_t lane = static_cast<size_t>(priority);
 
             {
                 std::unique_lock<Mutex> lock{ eventMutex };
-                tasks.emplace([=] { (*wrapper)(); });
+                tasks[lane].Push(std::move(queued));
+                statistics.RecordEnqueue(lane, tasks[lane].Length());
             }
 
             eventVar.notify_one();
-            return wrapper->get_future();
         }
 
-    private:
+        static constexpr size_t PRIORITY_COUNT = 3;
+        static constexpr size_t CHUNKS_PER_THREAD = 4;
+        static constexpr size_t PARALLEL_SORT_THRESHOLD = 4096;
 
         std::vector<Util::Thread> threads;
         ConditionVariable eventVar;
-        Mutex eventMutex;
+        mutable Mutex eventMutex;
         bool stopping = false;
-        std::queue<Function<void()>> tasks;
+        TaskQueue tasks[PRIORITY_COUNT];
+        ThreadPoolStatistics statistics;
+
+        static inline thread_local size_t workerIndex = 0;
+
+        bool HasPendingTasks() const
+        {
+            for (const auto& queue : tasks)
+            {
+                if (!queue.IsEmpty())
+                    return true;
+            }
+
+            return false;
+        }
+
+        QueuedTask PopNextTask()
+        {
+            for (size_t lane = 0; lane < PRIORITY_COUNT; ++lane)
+            {
+                if (!tasks[lane].IsEmpty())
+                {
+                    QueuedTask task = tasks[lane].Pop();
+                    statistics.RecordDequeue(lane, tasks[lane].Length());
+
+                    return task;
+                }
+            }
+
+            return {};
+        }
+
+        static uint64_t ToNanoseconds(SteadyClock::duration duration)
+        {
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+        }
 
         void Start(size_t numThreads)
         {
             for (auto i = 0u; i < numThreads; ++i)
             {
-                threads.emplace_back([=] 
+                threads.emplace_back([=]
                 {
+                    workerIndex = i;
+
                     while (true)
                     {
-                        Function<void()> task;
+                        QueuedTask task;
+                        SteadyClock::time_point idleStart = SteadyClock::now();
+
                         {
                             std::unique_lock<std::mutex> lock{ eventMutex };
 
                             eventVar.wait(lock, [=]
-                            { 
-                                return stopping || !tasks.empty(); 
+                            {
+                                return stopping || HasPendingTasks();
                             });
 
-                            if (stopping && tasks.empty())
+                            if (stopping && !HasPendingTasks())
                                 break;
 
-                            task = std::move(tasks.front());
-                            tasks.pop();
+                            task = PopNextTask();
                         }
 
-                        task();
+                        SteadyClock::time_point start = SteadyClock::now();
+
+                        task.function();
+
+                        SteadyClock::time_point finish = SteadyClock::now();
+
+                        statistics.RecordIdle(i, ToNanoseconds(start - idleStart));
+                        statistics.RecordWait(ToNanoseconds(start - task.enqueueTime));
+                        statistics.RecordRun(i, task.tag, ToNanoseconds(finish - start));
                     }
                 });
             }
@@ -84,6 +487,28 @@ namespace Invasion::Thread
 
             for (auto& thread : threads)
                 thread.join();
+
+            DropPendingTasks();
+        }
+
+        // Workers drain the queues before they exit, but anything queued after that, or everything when the pool has
+        // no workers, is never run. Dropping a task outside the lock lets a suspended coroutine resume as cancelled,
+        // and whatever that queues in turn is dropped the same way.
+        void DropPendingTasks() noexcept
+        {
+            while (true)
+            {
+                QueuedTask task;
+
+                {
+                    std::unique_lock<Mutex> lock{ eventMutex };
+
+                    if (!HasPendingTasks())
+                        return;
+
+                    task = PopNextTask();
+                }
+            }
         }
     };
 }
\ No newline at end of file
@@ -0,0 +1,308 @@
+#pragma once
+
+#include <bit>
+#include <cstdint>
+#include <sstream>
+#include "Util/StringId.hpp"
+#include "Util/Typedefs.hpp"
+
+using namespace Invasion::Util;
+
+namespace Invasion::Thread
+{
+    struct HistogramSnapshot
+    {
+        static constexpr size_t BUCKET_COUNT = 32;
+
+        uint64_t count = 0;
+        uint64_t totalNanoseconds = 0;
+        uint64_t maxNanoseconds = 0;
+        uint64_t buckets[BUCKET_COUNT] = {};
+
+        double GetMeanMicroseconds() const
+        {
+            return count == 0 ? 0.0 : static_cast<double>(totalNanoseconds) / static_cast<double>(count) / 1000.0;
+        }
+
+        uint64_t GetPercentileMicroseconds(double percentile) const
+        {
+            uint64_t target = static_cast<uint64_t>(static_cast<double>(count) * percentile);
+            uint64_t seen = 0;
+
+            for (size_t i = 0; i < BUCKET_COUNT; ++i)
+            {
+                seen += buckets[i];
+
+                if (seen > target)
+                    return i == 0 ? 0 : (uint64_t(1) << i) - 1;
+            }
+
+            return maxNanoseconds / 1000;
+        }
+
+        void WriteJson(std::ostream& stream) const
+        {
+            stream << "{\"count\":" << count
+                << ",\"meanUs\":" << GetMeanMicroseconds()
+                << ",\"p50Us\":" << GetPercentileMicroseconds(0.50)
+                << ",\"p99Us\":" << GetPercentileMicroseconds(0.99)
+                << ",\"maxUs\":" << maxNanoseconds / 1000
+                << ",\"log2UsBuckets\":[";
+
+            for (size_t i = 0; i < BUCKET_COUNT; ++i)
+                stream << (i == 0 ? "" : ",") << buckets[i];
+
+            stream << "]}";
+        }
+    };
+
+    class LatencyHistogram
+    {
+
+    public:
+
+        void Record(uint64_t nanoseconds)
+        {
+            size_t bucket = std::min<size_t>(std::bit_width(nanoseconds / 1000), HistogramSnapshot::BUCKET_COUNT - 1);
+
+            buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+            count.fetch_add(1, std::memory_order_relaxed);
+            totalNanoseconds.fetch_add(nanoseconds, std::memory_order_relaxed);
+
+            uint64_t previous = maxNanoseconds.load(std::memory_order_relaxed);
+
+            while (nanoseconds > previous && !maxNanoseconds.compare_exchange_weak(previous, nanoseconds, std::memory_order_relaxed)) { }
+        }
+
+        HistogramSnapshot GetSnapshot() const
+        {
+            HistogramSnapshot result;
+
+            result.count = count.load(std::memory_order_relaxed);
+            result.totalNanoseconds = totalNanoseconds.load(std::memory_order_relaxed);
+            result.maxNanoseconds = maxNanoseconds.load(std::memory_order_relaxed);
+
+            for (size_t i = 0; i < HistogramSnapshot::BUCKET_COUNT; ++i)
+                result.buckets[i] = buckets[i].load(std::memory_order_relaxed);
+
+            return result;
+        }
+
+    private:
+
+        Atomic<uint64_t> buckets[HistogramSnapshot::BUCKET_COUNT] = {};
+        Atomic<uint64_t> count = 0;
+        Atomic<uint64_t> totalNanoseconds = 0;
+        Atomic<uint64_t> maxNanoseconds = 0;
+
+    };
+
+    struct ThreadPoolStatisticsSnapshot
+    {
+        struct Worker
+        {
+            uint64_t busyNanoseconds = 0;
+            uint64_t idleNanoseconds = 0;
+            uint64_t tasksExecuted = 0;
+            uint64_t helpedChunks = 0;
+
+            double GetBusyRatio() const
+            {
+                uint64_t total = busyNanoseconds + idleNanoseconds;
+
+                return total == 0 ? 0.0 : static_cast<double>(busyNanoseconds) / static_cast<double>(total);
+            }
+        };
+
+        static constexpr size_t PRIORITY_COUNT = 3;
+
+        uint64_t queueDepth[PRIORITY_COUNT] = {};
+        uint64_t maxQueueDepth[PRIORITY_COUNT] = {};
+        uint64_t enqueued[PRIORITY_COUNT] = {};
+        HistogramSnapshot waitTime;
+        Vector<Pair<String, HistogramSnapshot>> runTimeByTag;
+        Vector<Worker> workers;
+
+        String ToJson() const
+        {
+            static const char* priorityNames[PRIORITY_COUNT] = { "critical", "normal", "background" };
+
+            OutputStringStream stream;
+
+            stream << "{\"queues\":{";
+
+            for (size_t i = 0; i < PRIORITY_COUNT; ++i)
+            {
+                stream << (i == 0 ? "" : ",") << "\"" << priorityNames[i] << "\":{\"depth\":" << queueDepth[i]
+                    << ",\"maxDepth\":" << maxQueueDepth[i] << ",\"enqueued\":" << enqueued[i] << "}";
+            }
+
+            stream << "},\"waitTime\":";
+            waitTime.WriteJson(stream);
+
+            stream << ",\"runTimeByTag\":{";
+
+            for (size_t i = 0; i < runTimeByTag.Length(); ++i)
+            {
+                stream << (i == 0 ? "" : ",") << "\"" << runTimeByTag[i].first.operator std::string() << "\":";
+                runTimeByTag[i].second.WriteJson(stream);
+            }
+
+            stream << "},\"workers\":[";
+
+            for (size_t i = 0; i < workers.Length(); ++i)
+            {
+                stream << (i == 0 ? "" : ",") << "{\"busyRatio\":" << workers[i].GetBusyRatio()
+                    << ",\"tasksExecuted\":" << workers[i].tasksExecuted << ",\"helpedChunks\":" << workers[i].helpedChunks << "}";
+            }
+
+            stream << "]}";
+
+            return stream.str();
+        }
+    };
+
+    class ThreadPoolStatistics
+    {
+
+    public:
+
+        ThreadPoolStatistics(const ThreadPoolStatistics&) = delete;
+        ThreadPoolStatistics& operator=(const ThreadPoolStatistics&) = delete;
+
+        explicit ThreadPoolStatistics(size_t workerCount) : workerCount(workerCount), workers(std::make_unique<WorkerCounters[]>(workerCount)) { }
+
+        void RecordEnqueue(size_t priority, size_t depth)
+        {
+            enqueued[priority].fetch_add(1, std::memory_order_relaxed);
+            queueDepth[priority].store(depth, std::memory_order_relaxed);
+
+            uint64_t previous = maxQueueDepth[priority].load(std::memory_order_relaxed);
+
+            while (depth > previous && !maxQueueDepth[priority].compare_exchange_weak(previous, depth, std::memory_order_relaxed)) { }
+        }
+
+        void RecordDequeue(size_t priority, size_t depth)
+        {
+            queueDepth[priority].store(depth, std::memory_order_relaxed);
+        }
+
+        void RecordWait(uint64_t nanoseconds)
+        {
+            waitTime.Record(nanoseconds);
+        }
+
+        void RecordRun(size_t worker, const char* tag, uint64_t nanoseconds)
+        {
+            workers[worker].busyNanoseconds.fetch_add(nanoseconds, std::memory_order_relaxed);
+            workers[worker].tasksExecuted.fetch_add(1, std::memory_order_relaxed);
+
+            GetTagSlot(tag).runTime.Record(nanoseconds);
+        }
+
+        void RecordIdle(size_t worker, uint64_t nanoseconds)
+        {
+            workers[worker].idleNanoseconds.fetch_add(nanoseconds, std::memory_order_relaxed);
+        }
+
+        // Counts ParallelFor chunks a worker picked up on behalf of another thread's loop.
+        void RecordHelpedChunk(size_t worker)
+        {
+            workers[worker].helpedChunks.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        ThreadPoolStatisticsSnapshot GetSnapshot() const
+        {
+            ThreadPoolStatisticsSnapshot result;
+
+            for (size_t i = 0; i < ThreadPoolStatisticsSnapshot::PRIORITY_COUNT; ++i)
+            {
+                result.queueDepth[i] = queueDepth[i].load(std::memory_order_relaxed);
+                result.maxQueueDepth[i] = maxQueueDepth[i].load(std::memory_order_relaxed);
+                result.enqueued[i] = enqueued[i].load(std::memory_order_relaxed);
+            }
+
+            result.waitTime = waitTime.GetSnapshot();
+
+            for (const TagSlot& slot : tags)
+            {
+                const char* tag = slot.tag.load(std::memory_order_acquire);
+
+                if (tag != nullptr)
+                    result.runTimeByTag += Pair<String, HistogramSnapshot>(String(tag), slot.runTime.GetSnapshot());
+            }
+
+            for (size_t i = 0; i < workerCount; ++i)
+            {
+                ThreadPoolStatisticsSnapshot::Worker worker;
+
+                worker.busyNanoseconds = workers[i].busyNanoseconds.load(std::memory_order_relaxed);
+                worker.idleNanoseconds = workers[i].idleNanoseconds.load(std::memory_order_relaxed);
+                worker.tasksExecuted = workers[i].tasksExecuted.load(std::memory_order_relaxed);
+                worker.helpedChunks = workers[i].helpedChunks.load(std::memory_order_relaxed);
+
+                result.workers += worker;
+            }
+
+            return result;
+        }
+
+        static constexpr size_t MAX_TAGS = 64;
+
+    private:
+
+        struct WorkerCounters
+        {
+            Atomic<uint64_t> busyNanoseconds = 0;
+            Atomic<uint64_t> idleNanoseconds = 0;
+            Atomic<uint64_t> tasksExecuted = 0;
+            Atomic<uint64_t> helpedChunks = 0;
+        };
+
+        struct TagSlot
+        {
+            Atomic<uint64_t> key = 0;
+            Atomic<const char*> tag = nullptr;
+            LatencyHistogram runTime;
+        };
+
+        // Tags are keyed by the StringId hash of their contents, so equal strings from different translation units or
+        // built at runtime share one histogram. The first pointer seen is kept for display, so tags must outlive the pool.
+        TagSlot& GetTagSlot(const char* tag)
+        {
+            uint64_t key = StringId::Hash(tag);
+            size_t start = static_cast<size_t>(key % (MAX_TAGS - 1));
+
+            for (size_t probe = 0; probe < MAX_TAGS - 1; ++probe)
+            {
+                TagSlot& slot = tags[(start + probe) % (MAX_TAGS - 1)];
+                uint64_t current = slot.key.load(std::memory_order_acquire);
+
+                if (current == 0 && slot.key.compare_exchange_strong(current, key, std::memory_order_acq_rel))
+                {
+                    slot.tag.store(tag, std::memory_order_release);
+                    return slot;
+                }
+
+                if (current == key)
+                    return slot;
+            }
+
+            const char* overflow = nullptr;
+            tags[MAX_TAGS - 1].tag.compare_exchange_strong(overflow, "other", std::memory_order_acq_rel);
+
+            return tags[MAX_TAGS - 1];
+        }
+
+        size_t workerCount;
+        Unique<WorkerCounters[]> workers;
+
+        Atomic<uint64_t> queueDepth[ThreadPoolStatisticsSnapshot::PRIORITY_COUNT] = {};
+        Atomic<uint64_t> maxQueueDepth[ThreadPoolStatisticsSnapshot::PRIORITY_COUNT] = {};
+        Atomic<uint64_t> enqueued[ThreadPoolStatisticsSnapshot::PRIORITY_COUNT] = {};
+
+        LatencyHistogram waitTime;
+        TagSlot tags[MAX_TAGS];
+
+    };
+}
\ No newline at end of file
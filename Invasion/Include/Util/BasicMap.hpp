@@ -3,27 +3,86 @@
 #include <memory>
 #include <map>
 #include <mutex>
+#include <shared_mutex>
 #include <unordered_map>
 #include <initializer_list>
 #include <functional>
+#include <type_traits>
 
 namespace Invasion::Util
 {
-    template <typename Key, typename Value, template <typename, typename> class T>
+    class NoLock
+    {
+
+    public:
+
+        void lock() { }
+        void unlock() { }
+        bool try_lock() { return true; }
+
+        void lock_shared() { }
+        void unlock_shared() { }
+        bool try_lock_shared() { return true; }
+
+    };
+
+    class MutexLock
+    {
+
+    public:
+
+        void lock() { mutex.lock(); }
+        void unlock() { mutex.unlock(); }
+        bool try_lock() { return mutex.try_lock(); }
+
+        void lock_shared() { mutex.lock(); }
+        void unlock_shared() { mutex.unlock(); }
+        bool try_lock_shared() { return mutex.try_lock(); }
+
+    private:
+
+        std::mutex mutex;
+
+    };
+
+    class SharedMutexLock
+    {
+
+    public:
+
+        void lock() { mutex.lock(); }
+        void unlock() { mutex.unlock(); }
+        bool try_lock() { return mutex.try_lock(); }
+
+        void lock_shared() { mutex.lock_shared(); }
+        void unlock_shared() { mutex.unlock_shared(); }
+        bool try_lock_shared() { return mutex.try_lock_shared(); }
+
+    private:
+
+        std::shared_mutex mutex;
+
+    };
+
+    template <typename Key, typename Value, template <typename, typename> class T, typename Lock = MutexLock>
     class BasicMap
     {
+
+        using ReadLock = std::shared_lock<Lock>;
+        using WriteLock = std::lock_guard<Lock>;
+
     public:
         BasicMap() = default;
 
         BasicMap(const BasicMap& other)
         {
-            std::lock_guard<std::mutex> lock(other.mutex);
+            ReadLock lock(other.mutex);
             data = other.data;
         }
 
         BasicMap(BasicMap&& other) noexcept
         {
-            std::lock_guard<std::mutex> lock(other.mutex);
+            WriteLock lock(other.mutex);
             data = std::move(other.data);
         }
 
@@ -39,8 +98,8 @@ namespace Invasion::Util
         {
             if (this != &other)
             {
-                std::lock_guard<std::mutex> lock(mutex);
-                std::lock_guard<std::mutex> other_lock(other.mutex);
+                WriteLock lock(mutex);
+                ReadLock otherLock(other.mutex);
                 data = other.data;
             }
             return *this;
@@ -50,8 +109,8 @@ namespace Invasion::Util
         {
             if (this != &other)
             {
-                std::lock_guard<std::mutex> lock(mutex);
-                std::lock_guard<std::mutex> other_lock(other.mutex);
+                WriteLock lock(mutex);
+                WriteLock otherLock(other.mutex);
                 data = std::move(other.data);
             }
             return *this;
@@ -59,7 +118,7 @@ namespace Invasion::Util
 
         BasicMap& operator=(std::map<Key, Value> map)
         {
-            std::lock_guard<std::mutex> lock(mutex);
+            WriteLock lock(mutex);
             if constexpr (std::is_same_v<T<Key, Value>, std::map<Key, Value>>)
                 data = std::move(map);
             else
@@ -72,7 +131,7 @@ namespace Invasion::Util
 
         BasicMap& operator=(std::unordered_map<Key, Value> map)
         {
-            std::lock_guard<std::mutex> lock(mutex);
+            WriteLock lock(mutex);
             if constexpr (std::is_same_v<T<Key, Value>, std::unordered_map<Key, Value>>)
                 data = std::move(map);
             else
@@ -85,14 +144,14 @@ namespace Invasion::Util
 
         bool operator==(const BasicMap& other) const
         {
-            std::lock_guard<std::mutex> lock(mutex);
-            std::lock_guard<std::mutex> other_lock(other.mutex_);
+            ReadLock lock(mutex);
+            ReadLock otherLock(other.mutex);
             return data == other.data;
         }
 
         bool operator==(const std::map<Key, Value>& map) const
         {
-            std::lock_guard<std::mutex> lock(mutex);
+            ReadLock lock(mutex);
             if constexpr (std::is_same_v<T<Key, Value>, std::map<Key, Value>>)
                 return data == map;
             else
@@ -101,7 +160,7 @@ namespace Invasion::Util
 
         bool operator==(const std::unordered_map<Key, Value>& map) const
         {
-            std::lock_guard<std::mutex> lock(mutex);
+            ReadLock lock(mutex);
             if constexpr (std::is_same_v<T<Key, Value>, std::unordered_map<Key, Value>>)
                 return data == map;
             else
@@ -125,58 +184,58 @@ namespace Invasion::Util
 
         BasicMap& operator+=(const BasicMap& other)
         {
-            std::lock_guard<std::mutex> lock(mutex);
-            std::lock_guard<std::mutex> other_lock(other.mutex_);
+            WriteLock lock(mutex);
+            ReadLock otherLock(other.mutex);
             data.insert(other.data.begin(), other.data.end());
             return *this;
         }
 
         BasicMap& operator+=(const std::map<Key, Value>& map)
         {
-            std::lock_guard<std::mutex> lock(mutex);
+            WriteLock lock(mutex);
             data.insert(map.begin(), map.end());
             return *this;
         }
 
         BasicMap& operator+=(const std::unordered_map<Key, Value>& map)
         {
-            std::lock_guard<std::mutex> lock(mutex);
+            WriteLock lock(mutex);
             data.insert(map.begin(), map.end());
             return *this;
         }
 
         BasicMap& operator+=(std::pair<Key, Value> pair)
         {
-            std::lock_guard<std::mutex> lock(mutex);
+            WriteLock lock(mutex);
             data.insert(pair);
             return *this;
         }
 
         BasicMap& operator+=(std::initializer_list<std::pair<const Key, Value>> list)
         {
-            std::lock_guard<std::mutex> lock(mutex);
+            WriteLock lock(mutex);
             data.insert(list);
             return *this;
         }
 
         BasicMap& operator|=(std::pair<Key, Value> other)
         {
-            std::lock_guard<std::mutex> lock(mutex);
+            WriteLock lock(mutex);
             data.insert(std::move(other));
             return *this;
         }
 
         BasicMap& operator|=(std::initializer_list<std::pair<const Key, Value>> list)
         {
-            std::lock_guard<std::mutex> lock(mutex);
+            WriteLock lock(mutex);
             data.insert(std::move(list));
             return *this;
         }
 
         BasicMap& operator-=(const BasicMap& other)
         {
-            std::lock_guard<std::mutex> lock(mutex);
-            std::lock_guard<std::mutex> other_lock(other.mutex_);
+            WriteLock lock(mutex);
+            ReadLock otherLock(other.mutex);
             for (const auto& pair : other.data)
                 data.erase(pair.first);
             return *this;
@@ -184,7 +243,7 @@ namespace Invasion::Util
 
         BasicMap& operator-=(const std::map<Key, Value>& map)
         {
-            std::lock_guard<std::mutex> lock(mutex);
+            WriteLock lock(mutex);
             for (const auto& pair : map)
                 data.erase(pair.first);
             return *this;
@@ -192,7 +251,7 @@ namespace Invasion::Util
 
         BasicMap& operator-=(const std::unordered_map<Key, Value>& map)
         {
-            std::lock_guard<std::mutex> lock(mutex);
+            WriteLock lock(mutex);
             for (const auto& pair : map)
                 data.erase(pair.first);
             return *this;
@@ -200,7 +259,7 @@ namespace Invasion::Util
 
         BasicMap& operator-=(const Key& key)
         {
-            std::lock_guard<std::mutex> lock(mutex);
+            WriteLock lock(mutex);
             data.erase(key);
             return *this;
         }
@@ -235,31 +294,31 @@ namespace Invasion::Util
 
         Value& operator[](const Key& key)
         {
-            std::lock_guard<std::mutex> lock(mutex);
+            WriteLock lock(mutex);
             return data[key];
         }
 
         const Value& operator[](const Key& key) const
         {
-            std::lock_guard<std::mutex> lock(mutex);
+            ReadLock lock(mutex);
             return data.at(key);
         }
 
         bool Contains(const Key& key) const
         {
-            std::lock_guard<std::mutex> lock(mutex);
+            ReadLock lock(mutex);
             return data.find(key) != data.end();
         }
 
         bool IsEmpty() const
         {
-            std::lock_guard<std::mutex> lock(mutex);
+            ReadLock lock(mutex);
             return data.empty();
         }
 
         bool Find(const Key& key, Value& value) const
         {
-            std::lock_guard<std::mutex> lock(mutex);
+            ReadLock lock(mutex);
             auto iterator = data.find(key);
             if (iterator != data.end())
             {
@@ -269,74 +328,102 @@ namespace Invasion::Util
             return false;
         }
 
-        void ForEach(const std::function<void(const Key&, Value&)>& function)
+        template <typename F>
+        void ForEach(F&& function)
         {
-            //std::lock_guard<std::mutex> lock(mutex);
             for (auto& pair : data)
-                function(pair.first, pair.second);
+            {
+                if constexpr (std::is_invocable_v<F&, const Key&, Value&>)
+                    function(pair.first, pair.second);
+                else if constexpr (std::is_invocable_v<F&, Value&>)
+                    function(pair.second);
+                else
+                    function(pair.first);
+            }
         }
 
-        void ForEach(const std::function<void(const Key&, const Value&)>& function) const
+        template <typename F>
+        void ForEach(F&& function) const
         {
-            //std::lock_guard<std::mutex> lock(mutex);
             for (const auto& pair : data)
-                function(pair.first, pair.second);
+            {
+                if constexpr (std::is_invocable_v<F&, const Key&, const Value&>)
+                    function(pair.first, pair.second);
+                else if constexpr (std::is_invocable_v<F&, const Value&>)
+                    function(pair.second);
+                else
+                    function(pair.first);
+            }
         }
 
-        void ForEach(const std::function<void(const Key&)>& function)
-		{
-			//std::lock_guard<std::mutex> lock(mutex);
-			for (auto& pair : data)
-				function(pair.first);
-		}
-
-        void ForEach(const std::function<void(Key&)>& function) const
+        template <typename F>
+        BasicMap Filter(F&& predicate) const
         {
-            //std::lock_guard<std::mutex> lock(mutex);
+            BasicMap result;
+            ReadLock lock(mutex);
+
             for (const auto& pair : data)
-				function(pair.first);
+            {
+                if (predicate(pair.first, pair.second))
+                    result.data.insert(pair);
+            }
+
+            return result;
         }
 
-        void ForEach(const std::function<void(const Value&)>& function) const
-		{
-			//std::lock_guard<std::mutex> lock(mutex);
-			for (const auto& pair : data)
-				function(pair.second);
-		}
+        template <typename F>
+        size_t RemoveIf(F&& predicate)
+        {
+            WriteLock lock(mutex);
+            size_t removed = 0;
+
+            for (auto iterator = data.begin(); iterator != data.end();)
+            {
+                if (predicate(iterator->first, iterator->second))
+                {
+                    iterator = data.erase(iterator);
+                    ++removed;
+                }
+                else
+                    ++iterator;
+            }
+
+            return removed;
+        }
 
         auto begin()
         {
-            std::lock_guard<std::mutex> lock(mutex);
+            ReadLock lock(mutex);
             return data.begin();
         }
 
         auto end()
         {
-            std::lock_guard<std::mutex> lock(mutex);
+            ReadLock lock(mutex);
             return data.end();
         }
 
         void Clear()
         {
-            std::lock_guard<std::mutex> lock(mutex);
+            WriteLock lock(mutex);
             data.clear();
         }
 
         size_t Count(Key key) const
         {
-            std::lock_guard<std::mutex> lock(mutex);
+            ReadLock lock(mutex);
             return data.count(key);
         }
 
         size_t Length() const
         {
-            std::lock_guard<std::mutex> lock(mutex);
+            ReadLock lock(mutex);
             return data.size();
         }
 
         operator std::map<Key, Value>() const
         {
-            std::lock_guard<std::mutex> lock(mutex);
+            ReadLock lock(mutex);
             if constexpr (std::is_same_v<T<Key, Value>, std::map<Key, Value>>)
                 return data;
             else
@@ -345,7 +432,7 @@ namespace Invasion::Util
 
         operator std::unordered_map<Key, Value>() const
         {
-            std::lock_guard<std::mutex> lock(mutex);
+            ReadLock lock(mutex);
             if constexpr (std::is_same_v<T<Key, Value>, std::unordered_map<Key, Value>>)
                 return data;
             else
@@ -354,7 +441,7 @@ namespace Invasion::Util
 
     private:
 
-        mutable std::mutex mutex;
+        mutable Lock mutex;
         T<Key, Value> data;
 
     };
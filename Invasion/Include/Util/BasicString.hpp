@@ -6,10 +6,10 @@
 #include <string>
 #include <string_view>
 #include <memory>
-#include <codecvt>
 #include <filesystem>
-#include <locale>
+#include <cctype>
 #include <algorithm>
+#include "Util/Unicode.hpp"
 
 namespace Invasion::Util
 {
@@ -71,8 +71,7 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, wchar_t>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                this->data = converter.from_bytes(data);
+                this->data = Unicode::ToWide(data);
             }
             else
                 this->data = data;
@@ -82,8 +81,7 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, wchar_t>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                this->data = converter.from_bytes(data);
+                this->data = Unicode::ToWide(data);
             }
             else
                 this->data = data;
@@ -93,8 +91,7 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, wchar_t>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                this->data = converter.from_bytes(data);
+                this->data = Unicode::ToWide(data);
             }
             else
                 this->data = data;
@@ -104,8 +101,7 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, wchar_t>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                this->data = converter.from_bytes(data.data());
+                this->data = Unicode::ToWide(data);
             }
             else
                 this->data = data;
@@ -115,8 +111,7 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, wchar_t>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                this->data = converter.from_bytes(data.data());
+                this->data = Unicode::ToWide(data);
             }
             else
                 this->data = data;
@@ -126,8 +121,7 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, char>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                this->data = converter.to_bytes(data);
+                this->data = Unicode::ToNarrow(data);
             }
             else
                 this->data = data;
@@ -137,8 +131,7 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, char>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                this->data = converter.to_bytes(data);
+                this->data = Unicode::ToNarrow(data);
             }
             else
                 this->data = data;
@@ -148,8 +141,7 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, char>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                this->data = converter.to_bytes(data);
+                this->data = Unicode::ToNarrow(data);
             }
             else
                 this->data = data;
@@ -159,8 +151,7 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, char>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                this->data = converter.to_bytes(data.data());
+                this->data = Unicode::ToNarrow(data);
             }
             else
                 this->data = data;
@@ -170,8 +161,7 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, char>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                this->data = converter.to_bytes(data.data());
+                this->data = Unicode::ToNarrow(data);
             }
             else
                 this->data = data;
@@ -181,8 +171,7 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, wchar_t>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                this->data = converter.from_bytes(data);
+                this->data = Unicode::ToWide(data);
             }
             else
                 this->data = data;
@@ -194,8 +183,7 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, wchar_t>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                this->data = converter.from_bytes(data);
+                this->data = Unicode::ToWide(data);
             }
             else
                 this->data = data;
@@ -206,8 +194,7 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, wchar_t>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                this->data = converter.from_bytes(data);
+                this->data = Unicode::ToWide(data);
             }
             else
                 this->data = data;
@@ -218,8 +205,7 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, wchar_t>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                this->data = converter.from_bytes(data.data());
+                this->data = Unicode::ToWide(data);
             }
             else
                 this->data = data;
@@ -230,8 +216,7 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, wchar_t>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                this->data = converter.from_bytes(data.data());
+                this->data = Unicode::ToWide(data);
             }
             else
                 this->data = data;
@@ -242,8 +227,7 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, char>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                this->data = converter.to_bytes(data);
+                this->data = Unicode::ToNarrow(data);
             }
             else
                 this->data = data;
@@ -254,8 +238,7 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, char>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                this->data = converter.to_bytes(data);
+                this->data = Unicode::ToNarrow(data);
             }
             else
                 this->data = data;
@@ -266,8 +249,7 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, char>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                this->data = converter.to_bytes(data);
+                this->data = Unicode::ToNarrow(data);
             }
             else
                 this->data = data;
@@ -278,8 +260,7 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, char>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                this->data = converter.to_bytes(data.data());
+                this->data = Unicode::ToNarrow(data);
             }
             else
                 this->data = data;
@@ -290,8 +271,7 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, char>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                this->data = converter.to_bytes(data.data());
+                this->data = Unicode::ToNarrow(data);
             }
             else
                 this->data = data;
@@ -314,8 +294,7 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, wchar_t>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                this->data += converter.from_bytes(other);
+                Unicode::AppendWide(this->data, other);
             }
             else
                 this->data += other;
@@ -326,8 +305,7 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, wchar_t>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                this->data += converter.from_bytes(other);
+                Unicode::AppendWide(this->data, other);
             }
             else
                 this->data += other;
@@ -338,8 +316,7 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, wchar_t>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                this->data += converter.from_bytes(other);
+                Unicode::AppendWide(this->data, other);
             }
             else
                 this->data += other;
@@ -350,8 +327,7 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, wchar_t>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                this->data += converter.from_bytes(other.data());
+                Unicode::AppendWide(this->data, other);
             }
             else
                 this->data += other.data();
@@ -362,8 +338,7 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, wchar_t>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                this->data += converter.from_bytes(other.data());
+                Unicode::AppendWide(this->data, other);
             }
             else
                 this->data += other.data();
@@ -374,8 +349,7 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, char>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                this->data += converter.to_bytes(other);
+                Unicode::AppendNarrow(this->data, other);
             }
             else
                 this->data += other;
@@ -386,8 +360,7 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, char>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                this->data += converter.to_bytes(other);
+                Unicode::AppendNarrow(this->data, other);
             }
             else
                 this->data += other;
@@ -398,8 +371,7 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, char>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                this->data += converter.to_bytes(other);
+                Unicode::AppendNarrow(this->data, other);
             }
             else
                 this->data += other;
@@ -410,8 +382,7 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, char>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                this->data += converter.to_bytes(other.data());
+                Unicode::AppendNarrow(this->data, other);
             }
             else
                 this->data += other.data();
@@ -422,8 +393,7 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, char>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                this->data += converter.to_bytes(other.data());
+                Unicode::AppendNarrow(this->data, other);
             }
             else
                 this->data += other.data();
@@ -566,8 +536,7 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, wchar_t>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                this->data += converter.from_bytes(other);
+                Unicode::AppendWide(this->data, other);
             }
             else
                 this->data += other;
@@ -578,8 +547,7 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, wchar_t>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                this->data += converter.from_bytes(other);
+                Unicode::AppendWide(this->data, other);
             }
             else
                 this->data += other;
@@ -590,8 +558,7 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, wchar_t>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                this->data += converter.from_bytes(other);
+                Unicode::AppendWide(this->data, other);
             }
             else
                 this->data += other;
@@ -602,8 +569,7 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, wchar_t>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                this->data += converter.from_bytes(other.data());
+                Unicode::AppendWide(this->data, other);
             }
             else
                 this->data += other.data();
@@ -614,8 +580,7 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, wchar_t>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                this->data += converter.from_bytes(other.data());
+                Unicode::AppendWide(this->data, other);
             }
             else
                 this->data += other.data();
@@ -626,8 +591,7 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, char>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                this->data += converter.to_bytes(other);
+                Unicode::AppendNarrow(this->data, other);
             }
             else
                 this->data += other;
@@ -638,8 +602,7 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, char>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                this->data += converter.to_bytes(other);
+                Unicode::AppendNarrow(this->data, other);
             }
             else
                 this->data += other;
@@ -650,8 +613,7 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, char>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                this->data += converter.to_bytes(other);
+                Unicode::AppendNarrow(this->data, other);
             }
             else
                 this->data += other;
@@ -662,8 +624,7 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, char>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                this->data += converter.to_bytes(other.data());
+                Unicode::AppendNarrow(this->data, other);
             }
             else
                 this->data += other.data();
@@ -674,8 +635,7 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, char>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                this->data += converter.to_bytes(other.data());
+                Unicode::AppendNarrow(this->data, other);
             }
             else
                 this->data += other.data();
@@ -857,9 +817,8 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, char>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                std::string find_str = converter.to_bytes(find);
-                std::string replace_str = converter.to_bytes(replace);
+                std::string find_str = Unicode::ToNarrow(find);
+                std::string replace_str = Unicode::ToNarrow(replace);
                 size_t pos = 0;
                 while ((pos = this->data.find(find_str, pos)) != std::string::npos)
                 {
@@ -884,9 +843,8 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, char>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                std::string find_str = converter.to_bytes(find);
-                std::string replace_str = converter.to_bytes(replace);
+                std::string find_str = Unicode::ToNarrow(find);
+                std::string replace_str = Unicode::ToNarrow(replace);
                 size_t pos = 0;
                 while ((pos = this->data.find(find_str, pos)) != std::string::npos)
                 {
@@ -911,9 +869,8 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, char>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                std::string find_str = converter.to_bytes(find);
-                std::string replace_str = converter.to_bytes(replace);
+                std::string find_str = Unicode::ToNarrow(find);
+                std::string replace_str = Unicode::ToNarrow(replace);
                 size_t pos = 0;
                 while ((pos = this->data.find(find_str, pos)) != std::string::npos)
                 {
@@ -938,9 +895,8 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, char>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                std::string find_str = converter.to_bytes(std::wstring(find));
-                std::string replace_str = converter.to_bytes(std::wstring(replace));
+                std::string find_str = Unicode::ToNarrow(find);
+                std::string replace_str = Unicode::ToNarrow(replace);
                 size_t pos = 0;
                 while ((pos = this->data.find(find_str, pos)) != std::string::npos)
                 {
@@ -965,9 +921,8 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, char>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                std::string find_str = converter.to_bytes(std::wstring(find));
-                std::string replace_str = converter.to_bytes(std::wstring(replace));
+                std::string find_str = Unicode::ToNarrow(find);
+                std::string replace_str = Unicode::ToNarrow(replace);
                 size_t pos = 0;
                 while ((pos = this->data.find(find_str, pos)) != std::string::npos)
                 {
@@ -1108,9 +1063,8 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, char>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                std::string find_str = converter.to_bytes(find);
-                std::string replace_str = converter.to_bytes(replace);
+                std::string find_str = Unicode::ToNarrow(find);
+                std::string replace_str = Unicode::ToNarrow(replace);
                 size_t pos = this->data.find(find_str);
                 if (pos != std::string::npos)
                     this->data.replace(pos, find_str.length(), replace_str);
@@ -1129,9 +1083,8 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, char>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                std::string find_str = converter.to_bytes(find);
-                std::string replace_str = converter.to_bytes(replace);
+                std::string find_str = Unicode::ToNarrow(find);
+                std::string replace_str = Unicode::ToNarrow(replace);
                 size_t pos = this->data.find(find_str);
                 if (pos != std::string::npos)
                     this->data.replace(pos, find_str.length(), replace_str);
@@ -1150,9 +1103,8 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, char>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                std::string find_str = converter.to_bytes(find);
-                std::string replace_str = converter.to_bytes(replace);
+                std::string find_str = Unicode::ToNarrow(find);
+                std::string replace_str = Unicode::ToNarrow(replace);
                 size_t pos = this->data.find(find_str);
                 if (pos != std::string::npos)
                     this->data.replace(pos, find_str.length(), replace_str);
@@ -1171,9 +1123,8 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, char>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                std::string find_str = converter.to_bytes(std::wstring(find));
-                std::string replace_str = converter.to_bytes(std::wstring(replace));
+                std::string find_str = Unicode::ToNarrow(find);
+                std::string replace_str = Unicode::ToNarrow(replace);
                 size_t pos = this->data.find(find_str);
                 if (pos != std::string::npos)
                     this->data.replace(pos, find_str.length(), replace_str);
@@ -1192,9 +1143,8 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, char>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                std::string find_str = converter.to_bytes(std::wstring(find));
-                std::string replace_str = converter.to_bytes(std::wstring(replace));
+                std::string find_str = Unicode::ToNarrow(find);
+                std::string replace_str = Unicode::ToNarrow(replace);
                 size_t pos = this->data.find(find_str);
                 if (pos != std::string::npos)
                     this->data.replace(pos, find_str.length(), replace_str);
@@ -1263,8 +1213,7 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, char>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                std::string replace_str = converter.to_bytes(replace);
+                std::string replace_str = Unicode::ToNarrow(replace);
                 this->data.replace(start, length, replace_str);
             }
             else
@@ -1278,8 +1227,7 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, char>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                std::string replace_str = converter.to_bytes(replace);
+                std::string replace_str = Unicode::ToNarrow(replace);
                 this->data.replace(start, length, replace_str);
             }
             else
@@ -1293,8 +1241,7 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, char>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                std::string replace_str = converter.to_bytes(replace);
+                std::string replace_str = Unicode::ToNarrow(replace);
                 this->data.replace(start, length, replace_str);
             }
             else
@@ -1308,8 +1255,7 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, char>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                std::string replace_str = converter.to_bytes(std::wstring(replace));
+                std::string replace_str = Unicode::ToNarrow(replace);
                 this->data.replace(start, length, replace_str);
             }
             else
@@ -1323,8 +1269,7 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, char>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                std::string replace_str = converter.to_bytes(std::wstring(replace));
+                std::string replace_str = Unicode::ToNarrow(replace);
                 this->data.replace(start, length, replace_str);
             }
             else
@@ -1369,8 +1314,7 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, wchar_t>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                return converter.to_bytes(this->data);
+                return Unicode::ToNarrow(this->data);
             }
             else
                 return this->data;
@@ -1380,8 +1324,7 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, char>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                return converter.from_bytes(this->data);
+                return Unicode::ToWide(this->data);
             }
             else
                 return this->data;
@@ -1391,8 +1334,7 @@ namespace Invasion::Util
 		{
 			if constexpr (std::is_same_v<T, wchar_t>)
 			{
-				std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-				return converter.to_bytes(this->data).c_str();
+				return Unicode::ToNarrow(this->data).c_str();
 			}
 			else
 				return this->data.c_str();
@@ -1402,8 +1344,7 @@ namespace Invasion::Util
         {
             if constexpr (std::is_same_v<T, char>)
             {
-                std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-                return converter.from_bytes(this->data).c_str();
+                return Unicode::ToWide(this->data).c_str();
             }
             else
                 return this->data.c_str();
@@ -1413,8 +1354,7 @@ namespace Invasion::Util
 		{
 			if constexpr (std::is_same_v<T, wchar_t>)
 			{
-				std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-				return const_cast<char*>(converter.to_bytes(this->data).c_str());
+				return const_cast<char*>(Unicode::ToNarrow(this->data).c_str());
 			}
 			else
 				return const_cast<char*>(this->data.c_str());
@@ -1424,8 +1364,7 @@ namespace Invasion::Util
 		{
 			if constexpr (std::is_same_v<T, char>)
 			{
-				std::wstring_convert<std::codecvt_utf8_utf16<wchar_t>> converter;
-				return const_cast<wchar_t*>(converter.from_bytes(this->data).c_str());
+				return const_cast<wchar_t*>(Unicode::ToWide(this->data).c_str());
 			}
 			else
 				return const_cast<wchar_t*>(this->data.c_str());
@@ -0,0 +1,183 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <utility>
+#include "Util/FlatHashMap.hpp"
+#include "Util/Vector.hpp"
+
+namespace Invasion::Util
+{
+	template <typename Key, typename Value, size_t ShardCount = 64, typename Hasher = std::hash<Key>>
+	class ConcurrentMap
+	{
+
+		static_assert(std::has_single_bit(ShardCount), "ShardCount must be a power of two");
+
+	public:
+
+		ConcurrentMap() = default;
+
+		ConcurrentMap(const ConcurrentMap&) = delete;
+		ConcurrentMap& operator=(const ConcurrentMap&) = delete;
+
+		void Insert(const Key& key, Value value)
+		{
+			Shard& shard = GetShard(key);
+			std::lock_guard<std::shared_mutex> lock(shard.mutex);
+
+			shard.data.insert_or_assign(key, std::move(value));
+		}
+
+		bool TryInsert(const Key& key, Value value)
+		{
+			Shard& shard = GetShard(key);
+			std::lock_guard<std::shared_mutex> lock(shard.mutex);
+
+			return shard.data.try_emplace(key, std::move(value)).second;
+		}
+
+		ConcurrentMap& operator+=(std::pair<Key, Value> pair)
+		{
+			Insert(pair.first, std::move(pair.second));
+			return *this;
+		}
+
+		bool Find(const Key& key, Value& out) const
+		{
+			const Shard& shard = GetShard(key);
+			std::shared_lock<std::shared_mutex> lock(shard.mutex);
+
+			auto iterator = shard.data.find(key);
+
+			if (iterator == shard.data.end())
+				return false;
+
+			out = iterator->second;
+
+			return true;
+		}
+
+		bool Contains(const Key& key) const
+		{
+			const Shard& shard = GetShard(key);
+			std::shared_lock<std::shared_mutex> lock(shard.mutex);
+
+			return shard.data.contains(key);
+		}
+
+		bool Remove(const Key& key)
+		{
+			Shard& shard = GetShard(key);
+			std::lock_guard<std::shared_mutex> lock(shard.mutex);
+
+			return shard.data.erase(key) != 0;
+		}
+
+		bool Extract(const Key& key, Value& out)
+		{
+			Shard& shard = GetShard(key);
+			std::lock_guard<std::shared_mutex> lock(shard.mutex);
+
+			auto iterator = shard.data.find(key);
+
+			if (iterator == shard.data.end())
+				return false;
+
+			out = std::move(iterator->second);
+			shard.data.erase(iterator);
+
+			return true;
+		}
+
+		ConcurrentMap& operator-=(const Key& key)
+		{
+			Remove(key);
+			return *this;
+		}
+
+		template <typename F>
+		void ForEach(F&& function) const
+		{
+			for (const Shard& shard : shards)
+			{
+				std::shared_lock<std::shared_mutex> lock(shard.mutex);
+
+				for (const auto& [key, value] : shard.data)
+					function(key, value);
+			}
+		}
+
+		Vector<std::pair<Key, Value>> GetSnapshot() const
+		{
+			Vector<std::pair<Key, Value>> result;
+
+			ForEach([&result](const Key& key, const Value& value) { result += std::pair<Key, Value>(key, value); });
+
+			return result;
+		}
+
+		void Clear()
+		{
+			for (Shard& shard : shards)
+			{
+				std::lock_guard<std::shared_mutex> lock(shard.mutex);
+				shard.data.clear();
+			}
+		}
+
+		size_t Length() const
+		{
+			size_t result = 0;
+
+			for (const Shard& shard : shards)
+			{
+				std::shared_lock<std::shared_mutex> lock(shard.mutex);
+				result += shard.data.size();
+			}
+
+			return result;
+		}
+
+		bool IsEmpty() const
+		{
+			return Length() == 0;
+		}
+
+	private:
+
+		struct alignas(64) Shard
+		{
+			mutable std::shared_mutex mutex;
+			FlatHashMap<Key, Value, Hasher> data;
+		};
+
+		static constexpr int SHARD_BITS = std::countr_zero(ShardCount);
+
+		static size_t GetShardIndex(const Key& key)
+		{
+			if constexpr (SHARD_BITS == 0)
+				return 0;
+			else
+				return static_cast<size_t>((static_cast<uint64_t>(Hasher{}(key)) * 0x9E3779B97F4A7C15ull) >> (64 - SHARD_BITS));
+		}
+
+		Shard& GetShard(const Key& key)
+		{
+			return shards[GetShardIndex(key)];
+		}
+
+		const Shard& GetShard(const Key& key) const
+		{
+			return shards[GetShardIndex(key)];
+		}
+
+		std::array<Shard, ShardCount> shards;
+
+	};
+}
\ No newline at end of file
@@ -0,0 +1,630 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "Util/Hash.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#include <emmintrin.h>
+#define INVASION_FLAT_HASH_MAP_SSE2
+#endif
+
+namespace Invasion::Util
+{
+	template <typename Key, typename Value, typename Hasher = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+	class FlatHashMap
+	{
+
+		template <bool IsConst>
+		class BasicIterator;
+
+	public:
+
+		using key_type = Key;
+		using mapped_type = Value;
+		using value_type = std::pair<const Key, Value>;
+		using size_type = size_t;
+		using iterator = BasicIterator<false>;
+		using const_iterator = BasicIterator<true>;
+
+		FlatHashMap() = default;
+
+		FlatHashMap(const FlatHashMap& other)
+		{
+			reserve(other.size());
+
+			for (const value_type& pair : other)
+				InsertUnique(Mix(Hasher{}(pair.first)), pair);
+		}
+
+		FlatHashMap(FlatHashMap&& other) noexcept
+		{
+			swap(other);
+		}
+
+		template <typename InputIterator>
+		FlatHashMap(InputIterator first, InputIterator last)
+		{
+			insert(first, last);
+		}
+
+		FlatHashMap(std::initializer_list<value_type> list)
+		{
+			insert(list);
+		}
+
+		~FlatHashMap()
+		{
+			Release();
+		}
+
+		FlatHashMap& operator=(const FlatHashMap& other)
+		{
+			if (this != &other)
+			{
+				FlatHashMap copy(other);
+				swap(copy);
+			}
+
+			return *this;
+		}
+
+		FlatHashMap& operator=(FlatHashMap&& other) noexcept
+		{
+			if (this != &other)
+			{
+				Release();
+				swap(other);
+			}
+
+			return *this;
+		}
+
+		bool operator==(const FlatHashMap& other) const
+		{
+			if (length != other.length)
+				return false;
+
+			for (const value_type& pair : *this)
+			{
+				const_iterator match = other.find(pair.first);
+
+				if (match == other.end() || !(match->second == pair.second))
+					return false;
+			}
+
+			return true;
+		}
+
+		iterator begin()
+		{
+			return iterator(control, slots, control + capacity);
+		}
+
+		iterator end()
+		{
+			return iterator(control + capacity, slots + capacity, control + capacity);
+		}
+
+		const_iterator begin() const
+		{
+			return const_iterator(control, slots, control + capacity);
+		}
+
+		const_iterator end() const
+		{
+			return const_iterator(control + capacity, slots + capacity, control + capacity);
+		}
+
+		template <typename K, typename... Args>
+		std::pair<iterator, bool> try_emplace(K&& key, Args&&... args)
+		{
+			size_t hash = Mix(Hasher{}(key));
+			size_t index = FindIndex(key, hash);
+
+			if (index != NOT_FOUND)
+				return { MakeIterator(index), false };
+
+			index = PrepareInsert(hash);
+			new (slots + index) value_type(std::piecewise_construct, std::forward_as_tuple(std::forward<K>(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+
+			return { MakeIterator(index), true };
+		}
+
+		template <typename K, typename V>
+		std::pair<iterator, bool> insert_or_assign(K&& key, V&& value)
+		{
+			std::pair<iterator, bool> result = try_emplace(std::forward<K>(key), std::forward<V>(value));
+
+			if (!result.second)
+				result.first->second = std::forward<V>(value);
+
+			return result;
+		}
+
+		template <typename P>
+		std::pair<iterator, bool> insert(P&& pair)
+		{
+			return try_emplace(std::forward<P>(pair).first, std::forward<P>(pair).second);
+		}
+
+		template <typename InputIterator>
+		void insert(InputIterator first, InputIterator last)
+		{
+			for (; first != last; ++first)
+				insert(*first);
+		}
+
+		void insert(std::initializer_list<value_type> list)
+		{
+			insert(list.begin(), list.end());
+		}
+
+		Value& operator[](const Key& key)
+		{
+			return try_emplace(key).first->second;
+		}
+
+		Value& operator[](Key&& key)
+		{
+			return try_emplace(std::move(key)).first->second;
+		}
+
+		Value& at(const Key& key)
+		{
+			size_t index = FindIndex(key, Mix(Hasher{}(key)));
+
+			if (index == NOT_FOUND)
+				throw std::out_of_range("FlatHashMap::at: key not found");
+
+			return slots[index].second;
+		}
+
+		const Value& at(const Key& key) const
+		{
+			return const_cast<FlatHashMap*>(this)->at(key);
+		}
+
+		iterator find(const Key& key)
+		{
+			size_t index = FindIndex(key, Mix(Hasher{}(key)));
+			return index == NOT_FOUND ? end() : MakeIterator(index);
+		}
+
+		const_iterator find(const Key& key) const
+		{
+			size_t index = FindIndex(key, Mix(Hasher{}(key)));
+			return index == NOT_FOUND ? end() : const_iterator(control + index, slots + index, control + capacity);
+		}
+
+		bool contains(const Key& key) const
+		{
+			return FindIndex(key, Mix(Hasher{}(key))) != NOT_FOUND;
+		}
+
+		size_t count(const Key& key) const
+		{
+			return contains(key) ? 1 : 0;
+		}
+
+		size_t erase(const Key& key)
+		{
+			size_t index = FindIndex(key, Mix(Hasher{}(key)));
+
+			if (index == NOT_FOUND)
+				return 0;
+
+			EraseAt(index);
+
+			return 1;
+		}
+
+		iterator erase(iterator position)
+		{
+			iterator next = position;
+			++next;
+
+			EraseAt(static_cast<size_t>(position.control - control));
+
+			return next;
+		}
+
+		void clear()
+		{
+			if (capacity == 0)
+				return;
+
+			DestroySlots();
+
+			std::memset(control, EMPTY, capacity + GROUP_WIDTH);
+			length = 0;
+			growthLeft = MaxLoad(capacity);
+		}
+
+		void reserve(size_t elementCount)
+		{
+			if (elementCount == 0)
+				return;
+
+			size_t required = GROUP_WIDTH;
+
+			while (MaxLoad(required) < elementCount)
+				required *= 2;
+
+			if (required > capacity)
+				Rehash(required);
+		}
+
+		void swap(FlatHashMap& other) noexcept
+		{
+			std::swap(control, other.control);
+			std::swap(slots, other.slots);
+			std::swap(capacity, other.capacity);
+			std::swap(length, other.length);
+			std::swap(growthLeft, other.growthLeft);
+		}
+
+		size_t size() const
+		{
+			return length;
+		}
+
+		bool empty() const
+		{
+			return length == 0;
+		}
+
+		size_t bucket_count() const
+		{
+			return capacity;
+		}
+
+		static constexpr size_t GROUP_WIDTH = 16;
+
+	private:
+
+		static constexpr int8_t EMPTY = -128;
+		static constexpr int8_t DELETED = -2;
+		static constexpr size_t NOT_FOUND = static_cast<size_t>(-1);
+
+		class Group
+		{
+
+		public:
+
+			explicit Group(const int8_t* position)
+			{
+#ifdef INVASION_FLAT_HASH_MAP_SSE2
+				bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(position));
+#else
+				std::memcpy(bytes, position, GROUP_WIDTH);
+#endif
+			}
+
+			uint32_t Match(int8_t fragment) const
+			{
+#ifdef INVASION_FLAT_HASH_MAP_SSE2
+				return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(fragment), bytes)));
+#else
+				uint32_t result = 0;
+
+				for (size_t i = 0; i < GROUP_WIDTH; ++i)
+					result |= static_cast<uint32_t>(bytes[i] == fragment) << i;
+
+				return result;
+#endif
+			}
+
+			uint32_t MatchEmpty() const
+			{
+				return Match(EMPTY);
+			}
+
+			uint32_t MatchEmptyOrDeleted() const
+			{
+#ifdef INVASION_FLAT_HASH_MAP_SSE2
+				return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), bytes)));
+#else
+				uint32_t result = 0;
+
+				for (size_t i = 0; i < GROUP_WIDTH; ++i)
+					result |= static_cast<uint32_t>(bytes[i] < -1) << i;
+
+				return result;
+#endif
+			}
+
+		private:
+
+#ifdef INVASION_FLAT_HASH_MAP_SSE2
+			__m128i bytes;
+#else
+			int8_t bytes[GROUP_WIDTH];
+#endif
+
+		};
+
+		template <bool IsConst>
+		class BasicIterator
+		{
+
+		public:
+
+			using iterator_category = std::forward_iterator_tag;
+			using value_type = FlatHashMap::value_type;
+			using difference_type = std::ptrdiff_t;
+			using pointer = std::conditional_t<IsConst, const value_type*, value_type*>;
+			using reference = std::conditional_t<IsConst, const value_type&, value_type&>;
+
+			BasicIterator() = default;
+
+			BasicIterator(const int8_t* control, pointer slot, const int8_t* last) : control(control), slot(slot), last(last)
+			{
+				SkipEmpty();
+			}
+
+			operator BasicIterator<true>() const
+			{
+				return BasicIterator<true>(control, slot, last);
+			}
+
+			reference operator*() const
+			{
+				return *slot;
+			}
+
+			pointer operator->() const
+			{
+				return slot;
+			}
+
+			BasicIterator& operator++()
+			{
+				++control;
+				++slot;
+				SkipEmpty();
+
+				return *this;
+			}
+
+			BasicIterator operator++(int)
+			{
+				BasicIterator result = *this;
+				++*this;
+
+				return result;
+			}
+
+			bool operator==(const BasicIterator& other) const
+			{
+				return control == other.control;
+			}
+
+			bool operator!=(const BasicIterator& other) const
+			{
+				return control != other.control;
+			}
+
+		private:
+
+			friend class FlatHashMap;
+
+			void SkipEmpty()
+			{
+				while (control != last && *control < 0)
+				{
+					uint32_t full = ~Group(control).MatchEmptyOrDeleted() & ((1u << GROUP_WIDTH) - 1);
+					size_t skip = std::min<size_t>(full != 0 ? std::countr_zero(full) : GROUP_WIDTH, static_cast<size_t>(last - control));
+
+					control += skip;
+					slot += skip;
+				}
+			}
+
+			const int8_t* control = nullptr;
+			pointer slot = nullptr;
+			const int8_t* last = nullptr;
+
+		};
+
+		static size_t Mix(size_t hash)
+		{
+			return static_cast<size_t>(Hash::Mix(static_cast<uint64_t>(hash)));
+		}
+
+		static int8_t GetFragment(size_t hash)
+		{
+			return static_cast<int8_t>(hash & 0x7F);
+		}
+
+		static size_t MaxLoad(size_t slotCount)
+		{
+			return slotCount - slotCount / 8;
+		}
+
+		iterator MakeIterator(size_t index)
+		{
+			return iterator(control + index, slots + index, control + capacity);
+		}
+
+		void SetControl(size_t index, int8_t value)
+		{
+			control[index] = value;
+
+			if (index < GROUP_WIDTH)
+				control[capacity + index] = value;
+		}
+
+		size_t FindIndex(const Key& key, size_t hash) const
+		{
+			if (capacity == 0)
+				return NOT_FOUND;
+
+			size_t mask = capacity - 1;
+			size_t position = (hash >> 7) & mask;
+			int8_t fragment = GetFragment(hash);
+
+			for (size_t step = GROUP_WIDTH;; step += GROUP_WIDTH)
+			{
+				Group group(control + position);
+
+				for (uint32_t matches = group.Match(fragment); matches != 0; matches &= matches - 1)
+				{
+					size_t index = (position + std::countr_zero(matches)) & mask;
+
+					if (KeyEqual{}(slots[index].first, key))
+						return index;
+				}
+
+				if (group.MatchEmpty() != 0)
+					return NOT_FOUND;
+
+				position = (position + step) & mask;
+			}
+		}
+
+		size_t FindInsertSlot(size_t hash) const
+		{
+			size_t mask = capacity - 1;
+			size_t position = (hash >> 7) & mask;
+
+			for (size_t step = GROUP_WIDTH;; step += GROUP_WIDTH)
+			{
+				uint32_t candidates = Group(control + position).MatchEmptyOrDeleted();
+
+				if (candidates != 0)
+					return (position + std::countr_zero(candidates)) & mask;
+
+				position = (position + step) & mask;
+			}
+		}
+
+		size_t PrepareInsert(size_t hash)
+		{
+			size_t index = capacity == 0 ? 0 : FindInsertSlot(hash);
+
+			if (capacity == 0 || (growthLeft == 0 && control[index] == EMPTY))
+			{
+				Rehash(capacity == 0 ? GROUP_WIDTH : (length + 1 > capacity * 7 / 16 ? capacity * 2 : capacity));
+				index = FindInsertSlot(hash);
+			}
+
+			if (control[index] == EMPTY)
+				--growthLeft;
+
+			SetControl(index, GetFragment(hash));
+			++length;
+
+			return index;
+		}
+
+		template <typename P>
+		void InsertUnique(size_t hash, P&& pair)
+		{
+			size_t index = FindInsertSlot(hash);
+
+			SetControl(index, GetFragment(hash));
+			new (slots + index) value_type(std::forward<P>(pair));
+
+			--growthLeft;
+			++length;
+		}
+
+		void EraseAt(size_t index)
+		{
+			slots[index].~value_type();
+
+			size_t before = (index - GROUP_WIDTH) & (capacity - 1);
+			uint32_t emptyAfter = Group(control + index).MatchEmpty();
+			uint32_t emptyBefore = Group(control + before).MatchEmpty();
+
+			bool wasNeverFull = emptyAfter != 0 && emptyBefore != 0 && std::countr_zero(emptyAfter) + std::countl_zero(emptyBefore << (32 - GROUP_WIDTH)) < static_cast<int>(GROUP_WIDTH);
+
+			SetControl(index, wasNeverFull ? EMPTY : DELETED);
+
+			if (wasNeverFull)
+				++growthLeft;
+
+			--length;
+		}
+
+		void Rehash(size_t newCapacity)
+		{
+			int8_t* oldControl = control;
+			value_type* oldSlots = slots;
+			size_t oldCapacity = capacity;
+
+			control = new int8_t[newCapacity + GROUP_WIDTH];
+			slots = static_cast<value_type*>(::operator new(newCapacity * sizeof(value_type), std::align_val_t{ alignof(value_type) }));
+			capacity = newCapacity;
+			length = 0;
+			growthLeft = MaxLoad(newCapacity);
+
+			std::memset(control, EMPTY, newCapacity + GROUP_WIDTH);
+
+			for (size_t i = 0; i < oldCapacity; ++i)
+			{
+				if (oldControl[i] < 0)
+					continue;
+
+				value_type& pair = oldSlots[i];
+
+				InsertUnique(Mix(Hasher{}(pair.first)), std::pair<Key&&, Value&&>(std::move(const_cast<Key&>(pair.first)), std::move(pair.second)));
+				pair.~value_type();
+			}
+
+			if (oldControl)
+			{
+				delete[] oldControl;
+				::operator delete(oldSlots, std::align_val_t{ alignof(value_type) });
+			}
+		}
+
+		void DestroySlots()
+		{
+			if constexpr (!std::is_trivially_destructible_v<value_type>)
+			{
+				for (size_t i = 0; i < capacity; ++i)
+				{
+					if (control[i] >= 0)
+						slots[i].~value_type();
+				}
+			}
+		}
+
+		void Release()
+		{
+			if (!control)
+				return;
+
+			DestroySlots();
+
+			delete[] control;
+			::operator delete(slots, std::align_val_t{ alignof(value_type) });
+
+			control = nullptr;
+			slots = nullptr;
+			capacity = 0;
+			length = 0;
+			growthLeft = 0;
+		}
+
+		int8_t* control = nullptr;
+		value_type* slots = nullptr;
+		size_t capacity = 0;
+		size_t length = 0;
+		size_t growthLeft = 0;
+
+	};
+}
\ No newline at end of file
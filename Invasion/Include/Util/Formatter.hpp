@@ -17,7 +17,7 @@ namespace Invasion::Util
 
         static String ColorFormat(const String& message)
         {
-            static const UnorderedMap<char, String> ansiMap =
+            static const UnorderedMap<char, String, NoLock> ansiMap =
             {
                 {'0', "\033[30m"},
                 {'1', "\033[34m"},
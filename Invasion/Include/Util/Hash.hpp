@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Invasion::Util
+{
+	class Hash
+	{
+
+	public:
+
+		Hash(const Hash&) = delete;
+		Hash& operator=(const Hash&) = delete;
+
+		static constexpr uint64_t Mix(uint64_t value)
+		{
+			value ^= value >> 30;
+			value *= 0xBF58476D1CE4E5B9ull;
+			value ^= value >> 27;
+			value *= 0x94D049BB133111EBull;
+			value ^= value >> 31;
+
+			return value;
+		}
+
+		static constexpr uint64_t Combine(uint64_t seed, uint64_t value)
+		{
+			return Mix(seed ^ Mix(value));
+		}
+
+		static constexpr uint64_t Pack(int32_t high, int32_t low)
+		{
+			return (static_cast<uint64_t>(static_cast<uint32_t>(high)) << 32) | static_cast<uint32_t>(low);
+		}
+
+	private:
+
+		Hash() = default;
+
+	};
+}
\ No newline at end of file
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace Invasion::Util
+{
+	struct HashStatistics
+	{
+		size_t keyCount = 0;
+		size_t distinctHashes = 0;
+		size_t bucketCount = 0;
+		size_t longestBucket = 0;
+
+		std::string ToString() const
+		{
+			std::ostringstream stream;
+
+			stream << keyCount << " keys, " << distinctHashes << " distinct hashes, longest bucket " << longestBucket << " of " << bucketCount;
+
+			return stream.str();
+		}
+
+		template <typename Key, typename Hasher = std::hash<Key>, typename Range>
+		static HashStatistics Measure(const Range& keys)
+		{
+			HashStatistics result;
+
+			std::unordered_set<Key, Hasher> set;
+			std::vector<size_t> hashes;
+
+			for (const Key& key : keys)
+			{
+				set.insert(key);
+				hashes.push_back(Hasher{}(key));
+			}
+
+			std::sort(hashes.begin(), hashes.end());
+
+			result.keyCount = set.size();
+			result.distinctHashes = static_cast<size_t>(std::unique(hashes.begin(), hashes.end()) - hashes.begin());
+			result.bucketCount = set.bucket_count();
+
+			for (size_t bucket = 0; bucket < set.bucket_count(); ++bucket)
+				result.longestBucket = std::max(result.longestBucket, set.bucket_size(bucket));
+
+			return result;
+		}
+	};
+}
\ No newline at end of file
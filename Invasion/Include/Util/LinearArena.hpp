@@ -0,0 +1,305 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "Util/MemoryTracker.hpp"
+
+namespace Invasion::Util
+{
+	struct ArenaStatistics
+	{
+		uint64_t frameCount = 0;
+		uint64_t peakFrameBytes = 0;
+	};
+
+	class LinearArena
+	{
+
+	public:
+
+		struct Marker
+		{
+			size_t block = 0;
+			size_t offset = 0;
+			size_t used = 0;
+		};
+
+		explicit LinearArena(size_t blockSize = DEFAULT_BLOCK_SIZE) : blockSize(blockSize) { }
+
+		LinearArena(const LinearArena&) = delete;
+		LinearArena& operator=(const LinearArena&) = delete;
+
+		~LinearArena()
+		{
+			for (Block& block : blocks)
+			{
+				MemoryTracker::RecordDeallocation(MemoryTag::UTIL, block.size);
+				::operator delete(block.memory, std::align_val_t{ BLOCK_ALIGNMENT });
+			}
+		}
+
+		void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t))
+		{
+			assert(std::this_thread::get_id() == owner && "LinearArena used from a thread that does not own it");
+
+			while (true)
+			{
+				if (current < blocks.size())
+				{
+					Block& block = blocks[current];
+
+					uintptr_t base = reinterpret_cast<uintptr_t>(block.memory);
+					uintptr_t aligned = (base + offset + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1);
+
+					if (aligned + size <= base + block.size)
+					{
+						size_t end = static_cast<size_t>(aligned - base) + size;
+
+						used += end - offset;
+						offset = end;
+						highWater = std::max(highWater, used);
+
+						return reinterpret_cast<void*>(aligned);
+					}
+
+					if (current + 1 < blocks.size())
+					{
+						++current;
+						offset = 0;
+
+						continue;
+					}
+				}
+
+				size_t required = std::max(blockSize, size + alignment);
+
+				blocks.push_back({ static_cast<char*>(::operator new(required, std::align_val_t{ BLOCK_ALIGNMENT })), required });
+				MemoryTracker::RecordAllocation(MemoryTag::UTIL, required);
+
+				current = blocks.size() - 1;
+				offset = 0;
+			}
+		}
+
+		void Deallocate(void* pointer, size_t size)
+		{
+			if (std::this_thread::get_id() != owner || current >= blocks.size())
+				return;
+
+			uintptr_t top = reinterpret_cast<uintptr_t>(blocks[current].memory) + offset;
+			uintptr_t start = reinterpret_cast<uintptr_t>(pointer);
+
+			if (start + size != top)
+				return;
+
+			size_t released = static_cast<size_t>(top - start);
+
+			offset -= released;
+			used -= released;
+		}
+
+		Marker GetMarker() const
+		{
+			return { current, offset, used };
+		}
+
+		void Rewind(const Marker& marker)
+		{
+			current = marker.block;
+			offset = marker.offset;
+			used = marker.used;
+		}
+
+		void Reset()
+		{
+			peak = std::max(peak, highWater);
+
+			current = 0;
+			offset = 0;
+			used = 0;
+			highWater = 0;
+		}
+
+		size_t GetUsed() const
+		{
+			return used;
+		}
+
+		size_t GetPeak() const
+		{
+			return std::max(peak, highWater);
+		}
+
+		size_t GetCapacity() const
+		{
+			size_t result = 0;
+
+			for (const Block& block : blocks)
+				result += block.size;
+
+			return result;
+		}
+
+		static LinearArena& GetFrame()
+		{
+			thread_local LinearArena instance;
+
+			uint64_t epoch = frameEpoch.load(std::memory_order_acquire);
+
+			if (instance.epoch != epoch)
+			{
+				RecordFrame(instance.highWater);
+
+				instance.Reset();
+				instance.epoch = epoch;
+			}
+
+			return instance;
+		}
+
+		static LinearArena& GetScratch()
+		{
+			thread_local LinearArena instance;
+			return instance;
+		}
+
+		static void EndFrame()
+		{
+			RecordFrame(GetFrame().highWater);
+
+			frameEpoch.fetch_add(1, std::memory_order_release);
+		}
+
+		static ArenaStatistics GetFrameStatistics()
+		{
+			ArenaStatistics result;
+
+			result.frameCount = frameEpoch.load(std::memory_order_relaxed);
+			result.peakFrameBytes = peakFrameBytes.load(std::memory_order_relaxed);
+
+			return result;
+		}
+
+		static constexpr size_t DEFAULT_BLOCK_SIZE = 256 * 1024;
+
+	private:
+
+		struct Block
+		{
+			char* memory;
+			size_t size;
+		};
+
+		static constexpr size_t BLOCK_ALIGNMENT = 64;
+
+		static void RecordFrame(size_t bytes)
+		{
+			uint64_t value = static_cast<uint64_t>(bytes);
+
+			uint64_t previous = peakFrameBytes.load(std::memory_order_relaxed);
+
+			while (value > previous && !peakFrameBytes.compare_exchange_weak(previous, value, std::memory_order_relaxed)) { }
+		}
+
+		std::vector<Block> blocks;
+		size_t blockSize;
+		size_t current = 0;
+		size_t offset = 0;
+		size_t used = 0;
+		size_t highWater = 0;
+		size_t peak = 0;
+		uint64_t epoch = 0;
+		std::thread::id owner = std::this_thread::get_id();
+
+		static inline std::atomic<uint64_t> frameEpoch = 0;
+		static inline std::atomic<uint64_t> peakFrameBytes = 0;
+
+	};
+
+	class ScratchScope
+	{
+
+	public:
+
+		ScratchScope() : arena(LinearArena::GetScratch()), marker(arena.GetMarker()) { }
+
+		ScratchScope(const ScratchScope&) = delete;
+		ScratchScope& operator=(const ScratchScope&) = delete;
+
+		~ScratchScope()
+		{
+			arena.Rewind(marker);
+		}
+
+		LinearArena& GetArena()
+		{
+			return arena;
+		}
+
+	private:
+
+		LinearArena& arena;
+		LinearArena::Marker marker;
+
+	};
+
+	template <typename T>
+	class ArenaAllocator
+	{
+
+	public:
+
+		using value_type = T;
+		using propagate_on_container_copy_assignment = std::false_type;
+		using propagate_on_container_move_assignment = std::true_type;
+		using propagate_on_container_swap = std::true_type;
+
+		ArenaAllocator() noexcept : arena(&LinearArena::GetFrame()) { }
+
+		ArenaAllocator(LinearArena& arena) noexcept : arena(&arena) { }
+
+		ArenaAllocator(ScratchScope& scope) noexcept : arena(&scope.GetArena()) { }
+
+		template <typename U>
+		ArenaAllocator(const ArenaAllocator<U>& other) noexcept : arena(other.GetArena()) { }
+
+		T* allocate(size_t count)
+		{
+			return static_cast<T*>(arena->Allocate(count * sizeof(T), alignof(T)));
+		}
+
+		void deallocate(T* pointer, size_t count) noexcept
+		{
+			arena->Deallocate(pointer, count * sizeof(T));
+		}
+
+		LinearArena* GetArena() const noexcept
+		{
+			return arena;
+		}
+
+		template <typename U>
+		bool operator==(const ArenaAllocator<U>& other) const noexcept
+		{
+			return arena == other.GetArena();
+		}
+
+		template <typename U>
+		bool operator!=(const ArenaAllocator<U>& other) const noexcept
+		{
+			return arena != other.GetArena();
+		}
+
+	private:
+
+		LinearArena* arena;
+
+	};
+}
\ No newline at end of file
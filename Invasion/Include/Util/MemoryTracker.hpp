@@ -0,0 +1,298 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace Invasion::Util
+{
+	enum class MemoryTag : uint8_t
+	{
+		WORLD,
+		RENDER,
+		ECS,
+		UTIL,
+		ASSETS,
+		COUNT
+	};
+
+	struct MemoryTagSnapshot
+	{
+		uint64_t liveBytes = 0;
+		uint64_t peakBytes = 0;
+		uint64_t liveAllocations = 0;
+		uint64_t totalAllocations = 0;
+	};
+
+	struct MemorySnapshot
+	{
+		static constexpr size_t TAG_COUNT = static_cast<size_t>(MemoryTag::COUNT);
+
+		MemoryTagSnapshot tags[TAG_COUNT];
+
+		const MemoryTagSnapshot& operator[](MemoryTag tag) const
+		{
+			return tags[static_cast<size_t>(tag)];
+		}
+
+		uint64_t GetTotalLiveBytes() const
+		{
+			uint64_t result = 0;
+
+			for (const MemoryTagSnapshot& tag : tags)
+				result += tag.liveBytes;
+
+			return result;
+		}
+
+		void WriteJson(std::ostream& stream) const
+		{
+			stream << "{";
+
+			for (size_t i = 0; i < TAG_COUNT; ++i)
+			{
+				stream << (i == 0 ? "" : ",") << "\"" << GetTagName(static_cast<MemoryTag>(i)) << "\":{"
+					<< "\"liveBytes\":" << tags[i].liveBytes
+					<< ",\"peakBytes\":" << tags[i].peakBytes
+					<< ",\"liveAllocations\":" << tags[i].liveAllocations
+					<< ",\"totalAllocations\":" << tags[i].totalAllocations << "}";
+			}
+
+			stream << "}";
+		}
+
+		std::string ToString() const
+		{
+			std::ostringstream stream;
+
+			stream << std::fixed << std::setprecision(2) << "Memory usage: " << ToMebibytes(GetTotalLiveBytes()) << " MiB live";
+
+			for (size_t i = 0; i < TAG_COUNT; ++i)
+			{
+				stream << "\n    " << std::left << std::setw(7) << GetTagName(static_cast<MemoryTag>(i)) << std::right
+					<< " live " << ToMebibytes(tags[i].liveBytes) << " MiB"
+					<< ", peak " << ToMebibytes(tags[i].peakBytes) << " MiB"
+					<< ", " << tags[i].liveAllocations << " live / " << tags[i].totalAllocations << " total allocations";
+			}
+
+			return stream.str();
+		}
+
+		static const char* GetTagName(MemoryTag tag)
+		{
+			switch (tag)
+			{
+
+			case MemoryTag::WORLD:
+				return "World";
+
+			case MemoryTag::RENDER:
+				return "Render";
+
+			case MemoryTag::ECS:
+				return "ECS";
+
+			case MemoryTag::UTIL:
+				return "Util";
+
+			case MemoryTag::ASSETS:
+				return "Assets";
+
+			default:
+				return "Unknown";
+			}
+		}
+
+	private:
+
+		static double ToMebibytes(uint64_t bytes)
+		{
+			return static_cast<double>(bytes) / (1024.0 * 1024.0);
+		}
+	};
+
+	class MemoryTracker
+	{
+
+	public:
+
+		MemoryTracker(const MemoryTracker&) = delete;
+		MemoryTracker& operator=(const MemoryTracker&) = delete;
+
+#ifdef INVASION_MEMORY_TRACKING
+		static constexpr bool ENABLED = true;
+#else
+		static constexpr bool ENABLED = false;
+#endif
+
+		static void RecordAllocation(MemoryTag tag, size_t bytes)
+		{
+			if constexpr (ENABLED)
+			{
+				Counters& counters = GetCounters(tag);
+
+				uint64_t live = counters.liveBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+				uint64_t previous = counters.peakBytes.load(std::memory_order_relaxed);
+
+				while (live > previous && !counters.peakBytes.compare_exchange_weak(previous, live, std::memory_order_relaxed)) { }
+
+				counters.liveAllocations.fetch_add(1, std::memory_order_relaxed);
+				counters.totalAllocations.fetch_add(1, std::memory_order_relaxed);
+			}
+		}
+
+		static void RecordDeallocation(MemoryTag tag, size_t bytes)
+		{
+			if constexpr (ENABLED)
+			{
+				Counters& counters = GetCounters(tag);
+
+				counters.liveBytes.fetch_sub(bytes, std::memory_order_relaxed);
+				counters.liveAllocations.fetch_sub(1, std::memory_order_relaxed);
+			}
+		}
+
+		static MemorySnapshot GetSnapshot()
+		{
+			MemorySnapshot result;
+
+			for (size_t i = 0; i < MemorySnapshot::TAG_COUNT; ++i)
+			{
+				const Counters& counters = GetCounters(static_cast<MemoryTag>(i));
+
+				result.tags[i].liveBytes = counters.liveBytes.load(std::memory_order_relaxed);
+				result.tags[i].peakBytes = counters.peakBytes.load(std::memory_order_relaxed);
+				result.tags[i].liveAllocations = counters.liveAllocations.load(std::memory_order_relaxed);
+				result.tags[i].totalAllocations = counters.totalAllocations.load(std::memory_order_relaxed);
+			}
+
+			return result;
+		}
+
+	private:
+
+		struct alignas(64) Counters
+		{
+			std::atomic<uint64_t> liveBytes = 0;
+			std::atomic<uint64_t> peakBytes = 0;
+			std::atomic<uint64_t> liveAllocations = 0;
+			std::atomic<uint64_t> totalAllocations = 0;
+		};
+
+		MemoryTracker() = default;
+
+		static Counters& GetCounters(MemoryTag tag)
+		{
+			static Counters counters[MemorySnapshot::TAG_COUNT];
+			return counters[static_cast<size_t>(tag)];
+		}
+
+	};
+
+	class TrackedBytes
+	{
+
+	public:
+
+		explicit TrackedBytes(MemoryTag tag) : tag(tag) { }
+
+		TrackedBytes(const TrackedBytes&) = delete;
+		TrackedBytes& operator=(const TrackedBytes&) = delete;
+
+		~TrackedBytes()
+		{
+			Set(0);
+		}
+
+		void Set(size_t newBytes)
+		{
+			if (bytes != 0)
+				MemoryTracker::RecordDeallocation(tag, bytes);
+
+			bytes = newBytes;
+
+			if (bytes != 0)
+				MemoryTracker::RecordAllocation(tag, bytes);
+		}
+
+		size_t Get() const
+		{
+			return bytes;
+		}
+
+	private:
+
+		MemoryTag tag;
+		size_t bytes = 0;
+
+	};
+
+	template <typename T, MemoryTag Tag, typename Base = std::allocator<T>>
+	class TrackingAllocator
+	{
+
+	public:
+
+		using value_type = T;
+		using propagate_on_container_copy_assignment = typename std::allocator_traits<Base>::propagate_on_container_copy_assignment;
+		using propagate_on_container_move_assignment = typename std::allocator_traits<Base>::propagate_on_container_move_assignment;
+		using propagate_on_container_swap = typename std::allocator_traits<Base>::propagate_on_container_swap;
+
+		template <typename U>
+		struct rebind
+		{
+			using other = TrackingAllocator<U, Tag, typename std::allocator_traits<Base>::template rebind_alloc<U>>;
+		};
+
+		TrackingAllocator() = default;
+
+		TrackingAllocator(const Base& base) : base(base) { }
+
+		template <typename U, typename OtherBase>
+		TrackingAllocator(const TrackingAllocator<U, Tag, OtherBase>& other) : base(other.GetBase()) { }
+
+		T* allocate(size_t count)
+		{
+			T* result = base.allocate(count);
+
+			MemoryTracker::RecordAllocation(Tag, count * sizeof(T));
+
+			return result;
+		}
+
+		void deallocate(T* pointer, size_t count) noexcept
+		{
+			MemoryTracker::RecordDeallocation(Tag, count * sizeof(T));
+
+			base.deallocate(pointer, count);
+		}
+
+		const Base& GetBase() const
+		{
+			return base;
+		}
+
+		template <typename U, typename OtherBase>
+		bool operator==(const TrackingAllocator<U, Tag, OtherBase>& other) const
+		{
+			return base == other.GetBase();
+		}
+
+		template <typename U, typename OtherBase>
+		bool operator!=(const TrackingAllocator<U, Tag, OtherBase>& other) const
+		{
+			return base != other.GetBase();
+		}
+
+	private:
+
+		Base base;
+
+	};
+}
\ No newline at end of file
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+
+namespace Invasion::Util
+{
+	template <size_t BlockSize, size_t BlockAlignment>
+	class BlockFreeList
+	{
+
+	public:
+
+		BlockFreeList(const BlockFreeList&) = delete;
+		BlockFreeList& operator=(const BlockFreeList&) = delete;
+
+		~BlockFreeList()
+		{
+			while (head)
+			{
+				Node* next = head->next;
+				::operator delete(head, std::align_val_t{ ALIGNMENT });
+				head = next;
+			}
+		}
+
+		void* Acquire()
+		{
+			if (head)
+			{
+				Node* node = head;
+				head = node->next;
+				--length;
+
+				return node;
+			}
+
+			return ::operator new(SIZE, std::align_val_t{ ALIGNMENT });
+		}
+
+		void Release(void* block)
+		{
+			if (length >= MAX_CACHED_BLOCKS)
+			{
+				::operator delete(block, std::align_val_t{ ALIGNMENT });
+				return;
+			}
+
+			Node* node = static_cast<Node*>(block);
+			node->next = head;
+			head = node;
+			++length;
+		}
+
+		static BlockFreeList& GetLocal()
+		{
+			thread_local BlockFreeList instance;
+			return instance;
+		}
+
+		static constexpr size_t MAX_CACHED_BLOCKS = 1024;
+
+	private:
+
+		struct Node
+		{
+			Node* next;
+		};
+
+		static constexpr size_t SIZE = BlockSize < sizeof(Node) ? sizeof(Node) : BlockSize;
+		static constexpr size_t ALIGNMENT = BlockAlignment < alignof(Node) ? alignof(Node) : BlockAlignment;
+
+		BlockFreeList() = default;
+
+		Node* head = nullptr;
+		size_t length = 0;
+
+	};
+
+	template <typename T>
+	class PoolAllocator
+	{
+
+	public:
+
+		using value_type = T;
+
+		PoolAllocator() noexcept = default;
+
+		template <typename U>
+		PoolAllocator(const PoolAllocator<U>&) noexcept { }
+
+		T* allocate(size_t count)
+		{
+			if (count != 1)
+				return std::allocator<T>().allocate(count);
+
+			return static_cast<T*>(BlockFreeList<sizeof(T), alignof(T)>::GetLocal().Acquire());
+		}
+
+		void deallocate(T* pointer, size_t count) noexcept
+		{
+			if (count != 1)
+			{
+				std::allocator<T>().deallocate(pointer, count);
+				return;
+			}
+
+			BlockFreeList<sizeof(T), alignof(T)>::GetLocal().Release(pointer);
+		}
+
+		template <typename U>
+		bool operator==(const PoolAllocator<U>&) const noexcept
+		{
+			return true;
+		}
+
+		template <typename U>
+		bool operator!=(const PoolAllocator<U>&) const noexcept
+		{
+			return false;
+		}
+
+	};
+}
\ No newline at end of file
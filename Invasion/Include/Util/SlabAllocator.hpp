@@ -0,0 +1,159 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace Invasion::Util
+{
+	template <typename T>
+	class SlabPool
+	{
+
+	public:
+
+		SlabPool(const SlabPool&) = delete;
+		SlabPool& operator=(const SlabPool&) = delete;
+
+		~SlabPool()
+		{
+			if (liveCount != 0)
+				return;
+
+			for (void* slab : slabs)
+				::operator delete(slab, std::align_val_t{ SLOT_ALIGNMENT });
+		}
+
+		void* Acquire()
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+
+			if (!freeList)
+				Grow();
+
+			Node* node = freeList;
+			freeList = node->next;
+			++liveCount;
+
+			return node;
+		}
+
+		void Release(void* pointer)
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+
+			Node* node = static_cast<Node*>(pointer);
+			node->next = freeList;
+			freeList = node;
+			--liveCount;
+		}
+
+		size_t GetLiveCount()
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			return liveCount;
+		}
+
+		size_t GetCapacity()
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			return slabs.size() * SLOTS_PER_SLAB;
+		}
+
+		static SlabPool& GetInstance()
+		{
+			// Intentionally leaked: pooled objects owned by other statics (the game, the world's chunk maps)
+			// are released during static destruction, after a function-local pool would already be gone.
+			static SlabPool* instance = new SlabPool;
+			return *instance;
+		}
+
+	private:
+
+		struct Node
+		{
+			Node* next;
+		};
+
+		static constexpr size_t SLOT_ALIGNMENT = alignof(T) < alignof(Node) ? alignof(Node) : alignof(T);
+		static constexpr size_t SLOT_SIZE = ((sizeof(T) < sizeof(Node) ? sizeof(Node) : sizeof(T)) + SLOT_ALIGNMENT - 1) / SLOT_ALIGNMENT * SLOT_ALIGNMENT;
+		static constexpr size_t SLAB_SIZE = 64 * 1024;
+		static constexpr size_t SLOTS_PER_SLAB = SLOT_SIZE >= SLAB_SIZE ? 1 : SLAB_SIZE / SLOT_SIZE;
+
+		SlabPool() = default;
+
+		void Grow()
+		{
+			char* slab = static_cast<char*>(::operator new(SLOT_SIZE * SLOTS_PER_SLAB, std::align_val_t{ SLOT_ALIGNMENT }));
+
+			slabs.push_back(slab);
+
+			for (size_t i = SLOTS_PER_SLAB; i-- > 0;)
+			{
+				Node* node = reinterpret_cast<Node*>(slab + i * SLOT_SIZE);
+				node->next = freeList;
+				freeList = node;
+			}
+		}
+
+		std::mutex mutex;
+		std::vector<void*> slabs;
+		Node* freeList = nullptr;
+		size_t liveCount = 0;
+
+	};
+
+	template <typename T>
+	class SlabAllocator
+	{
+
+	public:
+
+		using value_type = T;
+
+		SlabAllocator() noexcept = default;
+
+		template <typename U>
+		SlabAllocator(const SlabAllocator<U>&) noexcept { }
+
+		T* allocate(size_t count)
+		{
+			if (count != 1)
+				return std::allocator<T>().allocate(count);
+
+			return static_cast<T*>(SlabPool<T>::GetInstance().Acquire());
+		}
+
+		void deallocate(T* pointer, size_t count) noexcept
+		{
+			if (count != 1)
+			{
+				std::allocator<T>().deallocate(pointer, count);
+				return;
+			}
+
+			SlabPool<T>::GetInstance().Release(pointer);
+		}
+
+		template <typename U>
+		bool operator==(const SlabAllocator<U>&) const noexcept
+		{
+			return true;
+		}
+
+		template <typename U>
+		bool operator!=(const SlabAllocator<U>&) const noexcept
+		{
+			return false;
+		}
+
+	};
+
+	template <typename T, typename... Arguments>
+	std::shared_ptr<T> MakePooled(Arguments&&... arguments)
+	{
+		return std::allocate_shared<T>(SlabAllocator<T>(), std::forward<Arguments>(arguments)...);
+	}
+}
\ No newline at end of file
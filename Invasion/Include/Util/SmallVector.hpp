@@ -0,0 +1,457 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <initializer_list>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+#include "Util/Vector.hpp"
+
+namespace Invasion::Util
+{
+	template <typename T, size_t N, typename Allocator = std::allocator<T>>
+	class SmallVector
+	{
+
+		static_assert(N > 0, "SmallVector needs at least one inline element");
+
+	public:
+
+		SmallVector() = default;
+
+		explicit SmallVector(const Allocator& allocator) : allocator(allocator) { }
+
+		SmallVector(const SmallVector& other) : allocator(std::allocator_traits<Allocator>::select_on_container_copy_construction(other.allocator))
+		{
+			Reserve(other.length);
+			std::uninitialized_copy(other.begin(), other.end(), data);
+			length = other.length;
+		}
+
+		SmallVector(SmallVector&& other) noexcept : allocator(other.allocator)
+		{
+			MoveFrom(std::move(other));
+		}
+
+		SmallVector(std::initializer_list<T> list)
+		{
+			Reserve(list.size());
+			std::uninitialized_copy(list.begin(), list.end(), data);
+			length = list.size();
+		}
+
+		~SmallVector()
+		{
+			Clear();
+			Deallocate();
+		}
+
+		SmallVector& operator=(const SmallVector& other)
+		{
+			if (this != &other)
+			{
+				Clear();
+				Reserve(other.length);
+				std::uninitialized_copy(other.begin(), other.end(), data);
+				length = other.length;
+			}
+
+			return *this;
+		}
+
+		SmallVector& operator=(SmallVector&& other) noexcept
+		{
+			if (this != &other)
+			{
+				Clear();
+				Deallocate();
+				MoveFrom(std::move(other));
+			}
+
+			return *this;
+		}
+
+		SmallVector& operator+=(const SmallVector& other)
+		{
+			if (this == &other)
+				return *this += SmallVector(other);
+
+			Reserve(length + other.length);
+			std::uninitialized_copy(other.begin(), other.end(), data + length);
+			length += other.length;
+
+			return *this;
+		}
+
+		SmallVector& operator+=(const T& value)
+		{
+			if (length == capacity)
+			{
+				T copy = value;
+				Grow(capacity * 2);
+				new (data + length) T(std::move(copy));
+			}
+			else
+				new (data + length) T(value);
+
+			++length;
+
+			return *this;
+		}
+
+		SmallVector& operator|=(T&& value)
+		{
+			if (length == capacity)
+				Grow(capacity * 2);
+
+			new (data + length) T(std::move(value));
+			++length;
+
+			return *this;
+		}
+
+		SmallVector operator+(const SmallVector& other) const
+		{
+			SmallVector result = *this;
+			result += other;
+			return result;
+		}
+
+		SmallVector operator+(const T& value) const
+		{
+			SmallVector result = *this;
+			result += value;
+			return result;
+		}
+
+		SmallVector& operator-=(const SmallVector& other)
+		{
+			for (const T& value : other)
+				*this -= value;
+
+			return *this;
+		}
+
+		SmallVector& operator-=(const T& value)
+		{
+			T* iterator = std::find(begin(), end(), value);
+
+			if (iterator != end())
+			{
+				std::move(iterator + 1, end(), iterator);
+				data[--length].~T();
+			}
+
+			return *this;
+		}
+
+		SmallVector operator-(const SmallVector& other) const
+		{
+			SmallVector result = *this;
+			result -= other;
+			return result;
+		}
+
+		SmallVector operator-(const T& value) const
+		{
+			SmallVector result = *this;
+			result -= value;
+			return result;
+		}
+
+		bool operator==(const SmallVector& other) const
+		{
+			return std::equal(begin(), end(), other.begin(), other.end());
+		}
+
+		bool operator==(const std::vector<T>& vector) const
+		{
+			return std::equal(begin(), end(), vector.begin(), vector.end());
+		}
+
+		T& operator[](size_t index)
+		{
+			return data[index];
+		}
+
+		const T& operator[](size_t index) const
+		{
+			return data[index];
+		}
+
+		void Clear()
+		{
+			std::destroy(data, data + length);
+			length = 0;
+		}
+
+		size_t Length() const
+		{
+			return length;
+		}
+
+		size_t Capacity() const
+		{
+			return capacity;
+		}
+
+		bool IsEmpty() const
+		{
+			return length == 0;
+		}
+
+		bool IsInline() const
+		{
+			return data == GetInline();
+		}
+
+		T& Front()
+		{
+			return data[0];
+		}
+
+		const T& Front() const
+		{
+			return data[0];
+		}
+
+		T& Back()
+		{
+			return data[length - 1];
+		}
+
+		const T& Back() const
+		{
+			return data[length - 1];
+		}
+
+		void Resize(size_t size)
+		{
+			if (size < length)
+				std::destroy(data + size, data + length);
+			else
+			{
+				Reserve(size);
+				std::uninitialized_value_construct(data + length, data + size);
+			}
+
+			length = size;
+		}
+
+		void Reserve(size_t size)
+		{
+			if (size > capacity)
+				Grow(std::max(size, capacity * 2));
+		}
+
+		void ShrinkToFit()
+		{
+			if (IsInline() || length == capacity)
+				return;
+
+			T* previous = data;
+			size_t previousCapacity = capacity;
+
+			if (length <= N)
+			{
+				data = GetInline();
+				capacity = N;
+			}
+			else
+			{
+				data = allocator.allocate(length);
+				capacity = length;
+			}
+
+			std::uninitialized_move(previous, previous + length, data);
+			std::destroy(previous, previous + length);
+			allocator.deallocate(previous, previousCapacity);
+		}
+
+		void Swap(SmallVector& other)
+		{
+			SmallVector temporary = std::move(other);
+			other = std::move(*this);
+			*this = std::move(temporary);
+		}
+
+		template <typename F>
+		void ForEach(F&& function)
+		{
+			if constexpr (std::is_invocable_v<F&, T&, size_t>)
+			{
+				for (size_t index = 0; index < length; ++index)
+					function(data[index], index);
+			}
+			else if constexpr (std::is_invocable_v<F&, T&>)
+			{
+				for (T& value : *this)
+					function(value);
+			}
+			else
+			{
+				for (T& value : *this)
+					function(std::move(value));
+			}
+		}
+
+		template <typename F>
+		void ForEach(F&& function) const
+		{
+			if constexpr (std::is_invocable_v<F&, const T&, size_t>)
+			{
+				for (size_t index = 0; index < length; ++index)
+					function(data[index], index);
+			}
+			else
+			{
+				for (const T& value : *this)
+					function(value);
+			}
+		}
+
+		template <typename F>
+		SmallVector Filter(F&& predicate) const
+		{
+			SmallVector result(allocator);
+
+			for (const T& value : *this)
+			{
+				if (predicate(value))
+					result += value;
+			}
+
+			return result;
+		}
+
+		template <typename F>
+		auto Map(F&& function) const
+		{
+			using U = std::decay_t<std::invoke_result_t<F&, const T&>>;
+
+			Vector<U> result;
+			result.Reserve(length);
+
+			for (const T& value : *this)
+				result |= U(function(value));
+
+			return result;
+		}
+
+		template <typename F>
+		size_t RemoveIf(F&& predicate)
+		{
+			T* first = std::remove_if(begin(), end(), predicate);
+			size_t removed = static_cast<size_t>(end() - first);
+
+			std::destroy(first, end());
+			length -= removed;
+
+			return removed;
+		}
+
+		Allocator GetAllocator() const
+		{
+			return allocator;
+		}
+
+		void SwapRemove(size_t index)
+		{
+			if (index + 1 != length)
+				data[index] = std::move(data[length - 1]);
+
+			data[--length].~T();
+		}
+
+		const T* begin() const
+		{
+			return data;
+		}
+
+		const T* end() const
+		{
+			return data + length;
+		}
+
+		T* begin()
+		{
+			return data;
+		}
+
+		T* end()
+		{
+			return data + length;
+		}
+
+		operator std::vector<T>() const
+		{
+			return std::vector<T>(begin(), end());
+		}
+
+		operator T*()
+		{
+			return data;
+		}
+
+	private:
+
+		T* GetInline()
+		{
+			return reinterpret_cast<T*>(storage);
+		}
+
+		const T* GetInline() const
+		{
+			return reinterpret_cast<const T*>(storage);
+		}
+
+		void Grow(size_t newCapacity)
+		{
+			T* grown = allocator.allocate(newCapacity);
+
+			std::uninitialized_move(data, data + length, grown);
+			std::destroy(data, data + length);
+			Deallocate();
+
+			data = grown;
+			capacity = newCapacity;
+		}
+
+		void Deallocate()
+		{
+			if (!IsInline())
+				allocator.deallocate(data, capacity);
+
+			data = GetInline();
+			capacity = N;
+		}
+
+		void MoveFrom(SmallVector&& other)
+		{
+			if (other.IsInline())
+			{
+				std::uninitialized_move(other.begin(), other.end(), data);
+				length = other.length;
+				other.Clear();
+			}
+			else
+			{
+				allocator = other.allocator;
+				data = std::exchange(other.data, other.GetInline());
+				capacity = std::exchange(other.capacity, N);
+				length = std::exchange(other.length, 0);
+			}
+		}
+
+		alignas(T) unsigned char storage[sizeof(T) * N];
+		Allocator allocator;
+		T* data = GetInline();
+		size_t length = 0;
+		size_t capacity = N;
+
+	};
+}
\ No newline at end of file
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include "Util/Typedefs.hpp"
+
+namespace Invasion::Util
+{
+	class StringId
+	{
+
+	public:
+
+		constexpr StringId() = default;
+
+		StringId(const char* text) : value(Hash(text))
+		{
+			Intern(value, text);
+		}
+
+		StringId(const String& text) : StringId(static_cast<const char*>(text)) { }
+
+		constexpr uint64_t GetValue() const
+		{
+			return value;
+		}
+
+		constexpr bool IsValid() const
+		{
+			return value != 0;
+		}
+
+		String ToString() const
+		{
+			String result;
+
+			if (!GetTable().Find(value, result))
+				result = ("#" + std::to_string(value)).c_str();
+
+			return result;
+		}
+
+		constexpr bool operator==(const StringId& other) const
+		{
+			return value == other.value;
+		}
+
+		constexpr bool operator!=(const StringId& other) const
+		{
+			return value != other.value;
+		}
+
+		constexpr bool operator<(const StringId& other) const
+		{
+			return value < other.value;
+		}
+
+		static constexpr StringId FromValue(uint64_t value)
+		{
+			StringId result;
+			result.value = value;
+
+			return result;
+		}
+
+		static constexpr uint64_t Hash(std::string_view text)
+		{
+			uint64_t result = 0xCBF29CE484222325ull;
+
+			for (char character : text)
+			{
+				result ^= static_cast<uint8_t>(character);
+				result *= 0x100000001B3ull;
+			}
+
+			return result;
+		}
+
+	private:
+
+		static FlatMap<uint64_t, String, SharedMutexLock>& GetTable()
+		{
+			static FlatMap<uint64_t, String, SharedMutexLock> table;
+			return table;
+		}
+
+		static void Intern(uint64_t value, const char* text)
+		{
+			FlatMap<uint64_t, String, SharedMutexLock>& table = GetTable();
+
+			if (table.Contains(value))
+			{
+				assert(std::string_view(static_cast<const char*>(std::as_const(table)[value])) == std::string_view(text) && "StringId hash collision");
+				return;
+			}
+
+			table += std::pair<uint64_t, String>(value, String(text));
+		}
+
+		uint64_t value = 0;
+
+	};
+
+	template <size_t N>
+	struct StringLiteral
+	{
+		consteval StringLiteral(const char (&text)[N])
+		{
+			for (size_t i = 0; i < N; ++i)
+				data[i] = text[i];
+		}
+
+		constexpr std::string_view GetView() const
+		{
+			return std::string_view(data, N - 1);
+		}
+
+		char data[N] = {};
+	};
+
+	// One registration per distinct literal, run during static initialization, so ToString on a literal id shows its
+	// text even if the same string was never constructed as a StringId at runtime.
+	template <StringLiteral Text>
+	struct StringIdLiteral
+	{
+		static inline const StringId registration{ Text.data };
+	};
+
+	template <StringLiteral Text>
+	consteval StringId operator""_sid()
+	{
+		(void)&StringIdLiteral<Text>::registration;
+
+		return StringId::FromValue(StringId::Hash(Text.GetView()));
+	}
+}
+
+namespace std
+{
+	template <>
+	struct hash<Invasion::Util::StringId>
+	{
+		std::size_t operator()(const Invasion::Util::StringId& id) const noexcept
+		{
+			return static_cast<std::size_t>(id.GetValue());
+		}
+	};
+}
\ No newline at end of file
@@ -7,13 +7,16 @@
 #undef WriteConsole
 
 #include <any>
+#include <cassert>
 #include <iostream>
 #include <fstream>
 #include <ostream>
 #include <memory>
 #include <thread>
 #include <mutex>
+#include <shared_mutex>
 #include <condition_variable>
+#include <coroutine>
 #include <atomic>
 #include <future>
 #include <chrono>
@@ -31,6 +34,10 @@
 #include "Util/Array.hpp"
 #include "Util/BasicMap.hpp"
 #include "Util/BasicString.hpp"	
+#include "Util/FlatHashMap.hpp"
+#include "Util/LinearArena.hpp"
+#include "Util/MemoryTracker.hpp"
+#include "Util/SmallVector.hpp"
 #include "Util/Vector.hpp"
 
 namespace Invasion::Util
@@ -44,6 +51,7 @@ namespace Invasion::Util
 	
 	using Thread = std::thread;
 	using Mutex = std::mutex;
+	using SharedMutex = std::shared_mutex;
 	using ConditionVariable = std::condition_variable;
 
 	using Time = std::time_t;
@@ -60,6 +68,7 @@ namespace Invasion::Util
 	using Regex = std::regex;
 
 	using SystemClock = std::chrono::system_clock;
+	using SteadyClock = std::chrono::steady_clock;
 	using TimePoint = std::chrono::time_point<std::chrono::system_clock>;
 	using Duration = std::chrono::duration<float>;
 
@@ -73,11 +82,23 @@ namespace Invasion::Util
 	template <typename... Args>
 	using Variant = std::variant<Args...>;
 
-	template <typename Key, typename Value>
-	using UnorderedMap = BasicMap<Key, Value, std::unordered_map>;
+	template <typename Key, typename Value, typename Lock = MutexLock>
+	using UnorderedMap = BasicMap<Key, Value, std::unordered_map, Lock>;
 
-	template <typename Key, typename Value>
-	using OrderedMap = BasicMap<Key, Value, std::map>;
+	template <typename Key, typename Value, typename Lock = MutexLock>
+	using OrderedMap = BasicMap<Key, Value, std::map, Lock>;
+
+	template <typename Key, typename Value, typename Lock = MutexLock>
+	using FlatMap = BasicMap<Key, Value, FlatHashMap, Lock>;
+
+	template <typename T>
+	using ArenaVector = Vector<T, ArenaAllocator<T>>;
+
+	template <typename T, size_t N>
+	using ArenaSmallVector = SmallVector<T, N, ArenaAllocator<T>>;
+
+	template <typename T, MemoryTag Tag>
+	using TrackedVector = Vector<T, TrackingAllocator<T, Tag>>;
 
 	template <typename T>
 	using Match = std::match_results<T>;
@@ -114,4 +135,7 @@ namespace Invasion::Util
 
 	template <typename T>
 	using LockGuard = std::lock_guard<T>;
+
+	template <typename T>
+	using SharedLock = std::shared_lock<T>;
 }
\ No newline at end of file
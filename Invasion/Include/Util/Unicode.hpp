@@ -0,0 +1,376 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#include <emmintrin.h>
+#define INVASION_UNICODE_SSE2
+#endif
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define INVASION_UNICODE_AVX2
+#endif
+
+namespace Invasion::Util
+{
+	class Unicode
+	{
+
+	public:
+
+		Unicode(const Unicode&) = delete;
+		Unicode& operator=(const Unicode&) = delete;
+
+		static std::wstring ToWide(std::string_view text)
+		{
+			std::wstring result;
+			AppendWide(result, text);
+
+			return result;
+		}
+
+		static std::string ToNarrow(std::wstring_view text)
+		{
+			std::string result;
+			AppendNarrow(result, text);
+
+			return result;
+		}
+
+		static void AppendWide(std::wstring& output, std::string_view text)
+		{
+			size_t offset = output.size();
+
+			output.resize(offset + text.size());
+
+			try
+			{
+				wchar_t* end = DecodeUtf8(text.data(), text.data() + text.size(), output.data() + offset);
+
+				output.resize(static_cast<size_t>(end - output.data()));
+			}
+			catch (...)
+			{
+				output.resize(offset);
+				throw;
+			}
+		}
+
+		static void AppendNarrow(std::string& output, std::wstring_view text)
+		{
+			size_t offset = output.size();
+
+			output.resize(offset + text.size());
+
+			size_t ascii = NarrowAscii(text.data(), text.size(), output.data() + offset);
+
+			if (ascii == text.size())
+				return;
+
+			try
+			{
+				output.resize(offset + ascii + (text.size() - ascii) * MAX_BYTES_PER_UNIT);
+
+				char* end = EncodeUtf8(text.data() + ascii, text.data() + text.size(), output.data() + offset + ascii);
+
+				output.resize(static_cast<size_t>(end - output.data()));
+			}
+			catch (...)
+			{
+				output.resize(offset);
+				throw;
+			}
+		}
+
+	private:
+
+		Unicode() = default;
+
+		static constexpr bool WIDE_IS_UTF16 = sizeof(wchar_t) == 2;
+		static constexpr size_t MAX_BYTES_PER_UNIT = WIDE_IS_UTF16 ? 3 : 4;
+
+		static wchar_t* DecodeUtf8(const char* input, const char* end, wchar_t* output)
+		{
+			while (input < end)
+			{
+				size_t ascii = WidenAscii(input, static_cast<size_t>(end - input), output);
+
+				input += ascii;
+				output += ascii;
+
+				if (input == end)
+					break;
+
+				const uint8_t* bytes = reinterpret_cast<const uint8_t*>(input);
+				size_t remaining = static_cast<size_t>(end - input);
+				uint32_t codePoint;
+				size_t length;
+
+				if (bytes[0] >= 0xC2 && bytes[0] <= 0xDF)
+				{
+					length = 2;
+
+					if (remaining < 2 || !IsContinuation(bytes[1]))
+						throw std::range_error("Invalid UTF-8 sequence");
+
+					codePoint = ((bytes[0] & 0x1Fu) << 6) | (bytes[1] & 0x3Fu);
+				}
+				else if (bytes[0] >= 0xE0 && bytes[0] <= 0xEF)
+				{
+					length = 3;
+
+					uint8_t lower = bytes[0] == 0xE0 ? 0xA0 : 0x80;
+					uint8_t upper = bytes[0] == 0xED ? 0x9F : 0xBF;
+
+					if (remaining < 3 || bytes[1] < lower || bytes[1] > upper || !IsContinuation(bytes[2]))
+						throw std::range_error("Invalid UTF-8 sequence");
+
+					codePoint = ((bytes[0] & 0x0Fu) << 12) | ((bytes[1] & 0x3Fu) << 6) | (bytes[2] & 0x3Fu);
+				}
+				else if (bytes[0] >= 0xF0 && bytes[0] <= 0xF4)
+				{
+					length = 4;
+
+					uint8_t lower = bytes[0] == 0xF0 ? 0x90 : 0x80;
+					uint8_t upper = bytes[0] == 0xF4 ? 0x8F : 0xBF;
+
+					if (remaining < 4 || bytes[1] < lower || bytes[1] > upper || !IsContinuation(bytes[2]) || !IsContinuation(bytes[3]))
+						throw std::range_error("Invalid UTF-8 sequence");
+
+					codePoint = ((bytes[0] & 0x07u) << 18) | ((bytes[1] & 0x3Fu) << 12) | ((bytes[2] & 0x3Fu) << 6) | (bytes[3] & 0x3Fu);
+				}
+				else
+					throw std::range_error("Invalid UTF-8 sequence");
+
+				input += length;
+
+				if (WIDE_IS_UTF16 && codePoint >= 0x10000)
+				{
+					codePoint -= 0x10000;
+
+					*output++ = static_cast<wchar_t>(0xD800 + (codePoint >> 10));
+					*output++ = static_cast<wchar_t>(0xDC00 + (codePoint & 0x3FF));
+				}
+				else
+					*output++ = static_cast<wchar_t>(codePoint);
+			}
+
+			return output;
+		}
+
+		static char* EncodeUtf8(const wchar_t* input, const wchar_t* end, char* output)
+		{
+			while (input < end)
+			{
+				size_t ascii = NarrowAscii(input, static_cast<size_t>(end - input), output);
+
+				input += ascii;
+				output += ascii;
+
+				if (input == end)
+					break;
+
+				uint32_t codePoint = static_cast<uint32_t>(*input++);
+
+				if (codePoint >= 0xD800 && codePoint <= 0xDFFF)
+				{
+					if (!WIDE_IS_UTF16 || codePoint >= 0xDC00 || input == end)
+						throw std::range_error("Invalid UTF-16 sequence");
+
+					uint32_t low = static_cast<uint32_t>(*input++);
+
+					if (low < 0xDC00 || low > 0xDFFF)
+						throw std::range_error("Invalid UTF-16 sequence");
+
+					codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+				}
+				else if (codePoint > 0x10FFFF)
+					throw std::range_error("Invalid UTF-32 sequence");
+
+				if (codePoint < 0x800)
+				{
+					*output++ = static_cast<char>(0xC0 | (codePoint >> 6));
+					*output++ = static_cast<char>(0x80 | (codePoint & 0x3F));
+				}
+				else if (codePoint < 0x10000)
+				{
+					*output++ = static_cast<char>(0xE0 | (codePoint >> 12));
+					*output++ = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+					*output++ = static_cast<char>(0x80 | (codePoint & 0x3F));
+				}
+				else
+				{
+					*output++ = static_cast<char>(0xF0 | (codePoint >> 18));
+					*output++ = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+					*output++ = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+					*output++ = static_cast<char>(0x80 | (codePoint & 0x3F));
+				}
+			}
+
+			return output;
+		}
+
+		static bool IsContinuation(uint8_t byte)
+		{
+			return (byte & 0xC0) == 0x80;
+		}
+
+		static size_t WidenAscii(const char* input, size_t length, wchar_t* output)
+		{
+			size_t index = 0;
+
+#ifdef INVASION_UNICODE_AVX2
+			for (; index + 32 <= length; index += 32)
+			{
+				__m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + index));
+
+				if (_mm256_movemask_epi8(bytes) != 0)
+					break;
+
+				__m128i low = _mm256_castsi256_si128(bytes);
+				__m128i high = _mm256_extracti128_si256(bytes, 1);
+
+				if constexpr (WIDE_IS_UTF16)
+				{
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(output + index), _mm256_cvtepu8_epi16(low));
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(output + index + 16), _mm256_cvtepu8_epi16(high));
+				}
+				else
+				{
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(output + index), _mm256_cvtepu8_epi32(low));
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(output + index + 8), _mm256_cvtepu8_epi32(_mm_srli_si128(low, 8)));
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(output + index + 16), _mm256_cvtepu8_epi32(high));
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(output + index + 24), _mm256_cvtepu8_epi32(_mm_srli_si128(high, 8)));
+				}
+			}
+#endif
+
+#ifdef INVASION_UNICODE_SSE2
+			const __m128i zero = _mm_setzero_si128();
+
+			for (; index + 16 <= length; index += 16)
+			{
+				__m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + index));
+
+				if (_mm_movemask_epi8(bytes) != 0)
+					break;
+
+				__m128i low = _mm_unpacklo_epi8(bytes, zero);
+				__m128i high = _mm_unpackhi_epi8(bytes, zero);
+
+				if constexpr (WIDE_IS_UTF16)
+				{
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(output + index), low);
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(output + index + 8), high);
+				}
+				else
+				{
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(output + index), _mm_unpacklo_epi16(low, zero));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(output + index + 4), _mm_unpackhi_epi16(low, zero));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(output + index + 8), _mm_unpacklo_epi16(high, zero));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(output + index + 12), _mm_unpackhi_epi16(high, zero));
+				}
+			}
+#endif
+
+			for (; index < length; ++index)
+			{
+				uint8_t byte = static_cast<uint8_t>(input[index]);
+
+				if (byte >= 0x80)
+					break;
+
+				output[index] = static_cast<wchar_t>(byte);
+			}
+
+			return index;
+		}
+
+		static size_t NarrowAscii(const wchar_t* input, size_t length, char* output)
+		{
+			size_t index = 0;
+
+#ifdef INVASION_UNICODE_AVX2
+			if constexpr (WIDE_IS_UTF16)
+			{
+				const __m256i mask = _mm256_set1_epi16(static_cast<short>(0xFF80));
+
+				for (; index + 32 <= length; index += 32)
+				{
+					__m256i first = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + index));
+					__m256i second = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input + index + 16));
+
+					if (!_mm256_testz_si256(_mm256_or_si256(first, second), mask))
+						break;
+
+					__m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(first, second), 0xD8);
+
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(output + index), packed);
+				}
+			}
+#endif
+
+#ifdef INVASION_UNICODE_SSE2
+			const __m128i zero = _mm_setzero_si128();
+
+			if constexpr (WIDE_IS_UTF16)
+			{
+				const __m128i mask = _mm_set1_epi16(static_cast<short>(0xFF80));
+
+				for (; index + 16 <= length; index += 16)
+				{
+					__m128i first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + index));
+					__m128i second = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + index + 8));
+
+					__m128i high = _mm_and_si128(_mm_or_si128(first, second), mask);
+
+					if (_mm_movemask_epi8(_mm_cmpeq_epi8(high, zero)) != 0xFFFF)
+						break;
+
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(output + index), _mm_packus_epi16(first, second));
+				}
+			}
+			else
+			{
+				const __m128i mask = _mm_set1_epi32(static_cast<int>(0xFFFFFF80));
+
+				for (; index + 16 <= length; index += 16)
+				{
+					__m128i first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + index));
+					__m128i second = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + index + 4));
+					__m128i third = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + index + 8));
+					__m128i fourth = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + index + 12));
+
+					__m128i high = _mm_and_si128(_mm_or_si128(_mm_or_si128(first, second), _mm_or_si128(third, fourth)), mask);
+
+					if (_mm_movemask_epi8(_mm_cmpeq_epi8(high, zero)) != 0xFFFF)
+						break;
+
+					__m128i low = _mm_packs_epi32(first, second);
+					__m128i upper = _mm_packs_epi32(third, fourth);
+
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(output + index), _mm_packus_epi16(low, upper));
+				}
+			}
+#endif
+
+			for (; index < length; ++index)
+			{
+				uint32_t unit = static_cast<uint32_t>(input[index]);
+
+				if (unit >= 0x80)
+					break;
+
+				output[index] = static_cast<char>(unit);
+			}
+
+			return index;
+		}
+
+	};
+}
\ No newline at end of file
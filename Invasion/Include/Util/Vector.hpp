@@ -1,12 +1,15 @@
 #pragma once
 
+#include <algorithm>
 #include <initializer_list>
 #include <functional>
+#include <memory>
+#include <type_traits>
 #include <vector>
 
 namespace Invasion::Util
 {
-	template <typename T>
+	template <typename T, typename Allocator = std::allocator<T>>
 	class Vector
 	{
 
@@ -14,6 +17,8 @@ namespace Invasion::Util
 
 		Vector() = default;
 
+		explicit Vector(const Allocator& allocator) : data(allocator) {}
+
 		Vector(const Vector& other) : data(other.data) {}
 
 		Vector(int t, int a) : data(t, a) {}
@@ -36,9 +41,20 @@ namespace Invasion::Util
 			return *this;
 		}
 
+		template <typename OtherAllocator>
+		Vector& operator=(const Vector<T, OtherAllocator>& other)
+		{
+			data.assign(other.begin(), other.end());
+			return *this;
+		}
+
 		Vector& operator=(std::vector<T> vector)
 		{
-			data = std::move(vector);
+			if constexpr (std::is_same_v<Allocator, std::allocator<T>>)
+				data = std::move(vector);
+			else
+				data.assign(std::make_move_iterator(vector.begin()), std::make_move_iterator(vector.end()));
+
 			return *this;
 		}
 
@@ -48,6 +64,13 @@ namespace Invasion::Util
 			return *this;
 		}
 
+		template <typename OtherAllocator>
+		Vector& operator+=(const Vector<T, OtherAllocator>& other)
+		{
+			data.insert(data.end(), other.begin(), other.end());
+			return *this;
+		}
+
 		Vector& operator+=(const T& value)
 		{
 			data.push_back(value);
@@ -119,7 +142,7 @@ namespace Invasion::Util
 
 		bool operator==(const std::vector<T>& vector) const
 		{
-			return data == vector;
+			return std::equal(data.begin(), data.end(), vector.begin(), vector.end());
 		}
 
 		T& operator[](size_t index)
@@ -187,38 +210,86 @@ namespace Invasion::Util
 			data.swap(other.data);
 		}
 
-		void ForEach(const std::function<void(T&&)>& function)
+		template <typename F>
+		void ForEach(F&& function)
+		{
+			if constexpr (std::is_invocable_v<F&, T&, size_t>)
+			{
+				for (size_t index = 0; index < data.size(); ++index)
+					function(data[index], index);
+			}
+			else if constexpr (std::is_invocable_v<F&, T&>)
+			{
+				for (T& value : *this)
+					function(value);
+			}
+			else
+			{
+				for (T& value : *this)
+					function(std::move(value));
+			}
+		}
+
+		template <typename F>
+		void ForEach(F&& function) const
 		{
-			for (T& value : data)
-				function(std::move(value));
+			if constexpr (std::is_invocable_v<F&, const T&, size_t>)
+			{
+				for (size_t index = 0; index < data.size(); ++index)
+					function(data[index], index);
+			}
+			else
+			{
+				for (const T& value : *this)
+					function(value);
+			}
 		}
 
-		void ForEach(const std::function<void(const T&)>& function) const
+		template <typename F>
+		Vector Filter(F&& predicate) const
 		{
-			for (const T& value : data)
-				function(value);
+			Vector result(data.get_allocator());
+
+			for (const T& value : *this)
+			{
+				if (predicate(value))
+					result += value;
+			}
+
+			return result;
 		}
 
-		void ForEach(const std::function<void(T&)>& function)
+		template <typename F>
+		auto Map(F&& function) const
 		{
-			for (T& value : data)
-				function(value);
+			using U = std::decay_t<std::invoke_result_t<F&, const T&>>;
+
+			Vector<U> result;
+			result.Reserve(data.size());
+
+			for (const T& value : *this)
+				result |= U(function(value));
+
+			return result;
 		}
 
-		void ForEach(const std::function<void(const T&, size_t)>& function) const
+		template <typename F>
+		size_t RemoveIf(F&& predicate)
 		{
-			size_t index = 0;
+			auto first = std::remove_if(data.begin(), data.end(), predicate);
+			size_t removed = static_cast<size_t>(data.end() - first);
 
-			for (const T& value : data)
-				function(value, index++);
+			data.erase(first, data.end());
+
+			return removed;
 		}
 
-		void ForEach(const std::function<void(T&, size_t)>& function)
+		void SwapRemove(size_t index)
 		{
-			size_t index = 0;
+			if (index + 1 != data.size())
+				data[index] = std::move(data.back());
 
-			for (T& value : data)
-				function(value, index++);
+			data.pop_back();
 		}
 
 		auto begin() const
@@ -241,9 +312,17 @@ namespace Invasion::Util
 			return data.end();
 		}
 
+		Allocator GetAllocator() const
+		{
+			return data.get_allocator();
+		}
+
 		operator std::vector<T>() const
 		{
-			return data;
+			if constexpr (std::is_same_v<Allocator, std::allocator<T>>)
+				return data;
+			else
+				return std::vector<T>(data.begin(), data.end());
 		}
 
 		operator T*()
@@ -253,6 +332,6 @@ namespace Invasion::Util
 
 	private:
 
-		std::vector<T> data;
+		std::vector<T, Allocator> data;
 	};
 }
\ No newline at end of file
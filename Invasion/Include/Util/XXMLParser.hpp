@@ -31,12 +31,12 @@ namespace Invasion::Util
 			return version;
 		}
 
-		const UnorderedMap<std::string, VariableValue>& GetGlobalVariables() const
+		const UnorderedMap<std::string, VariableValue, NoLock>& GetGlobalVariables() const
 		{
 			return globalVariables;
 		}
 
-		const UnorderedMap<std::string, UnorderedMap<std::string, VariableValue>>& GetNamespaces() const
+		const UnorderedMap<std::string, UnorderedMap<std::string, VariableValue, NoLock>, NoLock>& GetNamespaces() const
 		{
 			return namespaces;
 		}
@@ -290,8 +290,8 @@ namespace Invasion::Util
 		String path; 
 		String version;
 
-		UnorderedMap<std::string, VariableValue> globalVariables;
-		UnorderedMap<std::string, UnorderedMap<std::string, VariableValue>> namespaces;
+		UnorderedMap<std::string, VariableValue, NoLock> globalVariables;
+		UnorderedMap<std::string, UnorderedMap<std::string, VariableValue, NoLock>, NoLock> namespaces;
 		Vector<std::string> globalDefines;
 
 		static const float VERSION;
@@ -2,10 +2,13 @@
 
 #include "ECS/GameObject.hpp"
 #include "Render/Mesh.hpp"
+#include "Thread/ThreadPool.hpp"
+#include "Util/SlabAllocator.hpp"
 #include "World/TextureAtlas.hpp"
 
 using namespace Invasion::ECS;
 using namespace Invasion::Render;
+using namespace Invasion::Thread;
 
 namespace Invasion::World
 {
@@ -24,14 +27,28 @@ namespace Invasion::World
 			CompressBlocks(blocks);
 		}
 
-		void Generate()
+		void Generate(ThreadPool& threadPool)
 		{
-			Vector<int> blocks = DecompressBlocks();
-			vertices.Clear();
-			indices.Clear();
+			ScratchScope scratch;
+
+			ArenaVector<int> blocks = DecompressBlocks(scratch);
+			Array<Vector2f, 4> texCoords = GetGameObject()->GetComponent<TextureAtlas>()->GetTextureCoordinates("dirt"_sid);
+
+			// Slabs are filled by helper threads and read back here after they return, so they live on the heap rather than
+			// in the helpers' frame arenas, which can be reset by the next frame while this chunk is still being meshed.
+			ArenaVector<Vector<Vertex>> slabVertices(scratch);
+			ArenaVector<Vector<unsigned int>> slabIndices(scratch);
+
+			slabVertices.Resize(CHUNK_SIZE);
+			slabIndices.Resize(CHUNK_SIZE);
 
-			for (int x = 0; x < CHUNK_SIZE; ++x)
+			threadPool.ParallelFor(0, CHUNK_SIZE, [&](size_t slab)
 			{
+				int x = static_cast<int>(slab);
+
+				Vector<Vertex> localVertices;
+				Vector<unsigned int> localIndices;
+
 				for (int y = 0; y < CHUNK_SIZE; ++y)
 				{
 					for (int z = 0; z < CHUNK_SIZE; ++z)
@@ -48,10 +65,26 @@ namespace Invasion::World
 							int nz = z + FaceOffsets[i][2];
 
  							if (!IsValidPosition({ nx, ny, nz }) || GetBlock(blocks, { nx, ny, nz }) == 0)
-								AddFace({ x, y, z }, i);
+								AddFace(localVertices, localIndices, { x, y, z }, i, texCoords);
 						}
 					}
 				}
+
+				slabVertices[slab] = std::move(localVertices);
+				slabIndices[slab] = std::move(localIndices);
+			}, 1);
+
+			vertices.Clear();
+			indices.Clear();
+
+			for (size_t slab = 0; slab < CHUNK_SIZE; ++slab)
+			{
+				unsigned int offset = static_cast<unsigned int>(vertices.Length());
+
+				vertices += slabVertices[slab];
+
+				for (unsigned int index : slabIndices[slab])
+					indices += offset + index;
 			}
 
 			mesh->SetVertices(vertices);
@@ -63,7 +96,7 @@ namespace Invasion::World
 		static Shared<Chunk> Create()
 		{
 			class Enabled : public Chunk { };
-			Shared<Chunk> result = std::make_shared<Enabled>();
+			Shared<Chunk> result = MakePooled<Enabled>();
 
 			return std::move(result);
 		}
@@ -76,10 +109,10 @@ namespace Invasion::World
 
 		Shared<Mesh> mesh;
 
-		Vector<Pair<int, int>> rleBlocks;
+		TrackedVector<Pair<int, int>, MemoryTag::WORLD> rleBlocks;
 
-		Vector<Vertex> vertices;
-		Vector<unsigned int> indices;
+		TrackedVector<Vertex, MemoryTag::WORLD> vertices;
+		TrackedVector<unsigned int, MemoryTag::WORLD> indices;
 
 		static constexpr int FaceOffsets[6][3] = 
 		{
@@ -88,7 +121,7 @@ namespace Invasion::World
 			{ 0, 0, 1 }, { 0, 0, -1 }
 		};
 
-		int GetBlock(const Vector<int>& blocks, const Vector3i& position) const
+		int GetBlock(const ArenaVector<int>& blocks, const Vector3i& position) const
 		{
 			if (!IsValidPosition(position))
 				return 0;
@@ -107,7 +140,7 @@ namespace Invasion::World
 				position.z >= 0 && position.z < CHUNK_SIZE;
 		}
 
-		void AddFace(const Vector3i& position, int faceIndex)
+		void AddFace(Vector<Vertex>& vertices, Vector<unsigned int>& indices, const Vector3i& position, int faceIndex, const Array<Vector2f, 4>& texCoords) const
 		{
 			static const Vector3f faceOffsets[6][4] = 
 			{
@@ -119,8 +152,6 @@ namespace Invasion::World
 				{ Vector3f(0, 0, 0), Vector3f(0, 1, 0), Vector3f(1, 1, 0), Vector3f(1, 0, 0) },
 			};
 
-			Array<Vector2f, 4> texCoords = GetGameObject()->GetComponent<TextureAtlas>()->GetTextureCoordinates("dirt"); 
-
 			static const Vector3f normals[6] =
 			{
 				Vector3f(1.0f, 0.0f, 0.0f),
@@ -177,14 +208,18 @@ namespace Invasion::World
 			rleBlocks += Pair(currentBlock, runLength);
 		}
 
-		Vector<int> DecompressBlocks() const
+		ArenaVector<int> DecompressBlocks(ScratchScope& scratch) const
 		{
-			Vector<int> decompressed;
+			ArenaVector<int> decompressed(scratch);
+			size_t total = 0;
 
 			for (const auto& [block, length] : rleBlocks)
-			{
-				decompressed.Reserve(decompressed.Length() + length);
+				total += static_cast<size_t>(length);
+
+			decompressed.Reserve(total);
 
+			for (const auto& [block, length] : rleBlocks)
+			{
 				for (int i = 0; i < length; ++i)
 					decompressed += block;
 			}
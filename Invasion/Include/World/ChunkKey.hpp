@@ -0,0 +1,141 @@
+#pragma once
+
+#include <cstdint>
+#include "Core/Logger.hpp"
+#include "Math/Vector3.hpp"
+#include "Util/Hash.hpp"
+#include "Util/HashStatistics.hpp"
+
+using namespace Invasion::Core;
+using namespace Invasion::Math;
+using namespace Invasion::Util;
+
+namespace Invasion::World
+{
+    struct ChunkKey
+    {
+        uint64_t value = 0;
+
+        ChunkKey() = default;
+
+        explicit ChunkKey(const Vector3i& coordinates) : value(Spread(coordinates.x) | (Spread(coordinates.y) << 1) | (Spread(coordinates.z) << 2)) { }
+
+        Vector3i ToCoordinates() const
+        {
+            return Vector3i(Compact(value), Compact(value >> 1), Compact(value >> 2));
+        }
+
+        bool IsWithin(const ChunkKey& minimum, const ChunkKey& maximum) const
+        {
+            for (uint64_t mask : AXIS_MASKS)
+            {
+                uint64_t axis = value & mask;
+
+                if (axis < (minimum.value & mask) || axis > (maximum.value & mask))
+                    return false;
+            }
+
+            return true;
+        }
+
+        bool operator==(const ChunkKey& other) const
+        {
+            return value == other.value;
+        }
+
+        bool operator!=(const ChunkKey& other) const
+        {
+            return value != other.value;
+        }
+
+        bool operator<(const ChunkKey& other) const
+        {
+            return value < other.value;
+        }
+
+        static ChunkKey FromValue(uint64_t value)
+        {
+            ChunkKey result;
+            result.value = value;
+
+            return result;
+        }
+
+        // Debug self-check: hashes a 128x4x128 chunk grid, the shape of a streamed world, through std::unordered_set and
+        // logs the bucket statistics for both Vector3i and ChunkKey. Returns false if either hash clusters.
+        static bool CheckHashDistribution()
+        {
+            Vector<Vector3i> coordinates;
+            Vector<ChunkKey> keys;
+
+            for (int x = -GRID_EXTENT; x < GRID_EXTENT; ++x)
+            {
+                for (int y = 0; y < GRID_HEIGHT; ++y)
+                {
+                    for (int z = -GRID_EXTENT; z < GRID_EXTENT; ++z)
+                    {
+                        coordinates += Vector3i(x, y, z);
+                        keys += ChunkKey(Vector3i(x, y, z));
+                    }
+                }
+            }
+
+            HashStatistics coordinateStatistics = HashStatistics::Measure<Vector3i>(coordinates);
+            HashStatistics keyStatistics = HashStatistics::Measure<ChunkKey>(keys);
+
+            Logger_WriteConsole("Vector3i hash: " + coordinateStatistics.ToString(), LogLevel::DEBUGGING);
+            Logger_WriteConsole("ChunkKey hash: " + keyStatistics.ToString(), LogLevel::DEBUGGING);
+
+            return coordinateStatistics.longestBucket <= MAXIMUM_EXPECTED_BUCKET && keyStatistics.longestBucket <= MAXIMUM_EXPECTED_BUCKET;
+        }
+
+        static constexpr int BITS_PER_AXIS = 21;
+        static constexpr int32_t MINIMUM_COORDINATE = -(1 << (BITS_PER_AXIS - 1));
+        static constexpr int32_t MAXIMUM_COORDINATE = (1 << (BITS_PER_AXIS - 1)) - 1;
+
+    private:
+
+        static constexpr int GRID_EXTENT = 64;
+        static constexpr int GRID_HEIGHT = 4;
+        static constexpr size_t MAXIMUM_EXPECTED_BUCKET = 16;
+
+        static constexpr uint64_t AXIS_MASKS[3] = { 0x1249249249249249ull, 0x2492492492492492ull, 0x4924924924924924ull };
+
+        static uint64_t Spread(int32_t coordinate)
+        {
+            uint64_t bits = static_cast<uint64_t>(static_cast<uint32_t>(coordinate - MINIMUM_COORDINATE)) & 0x1FFFFF;
+
+            bits = (bits | (bits << 32)) & 0x1F00000000FFFFull;
+            bits = (bits | (bits << 16)) & 0x1F0000FF0000FFull;
+            bits = (bits | (bits << 8)) & 0x100F00F00F00F00Full;
+            bits = (bits | (bits << 4)) & 0x10C30C30C30C30C3ull;
+            bits = (bits | (bits << 2)) & 0x1249249249249249ull;
+
+            return bits;
+        }
+
+        static int32_t Compact(uint64_t bits)
+        {
+            bits &= 0x1249249249249249ull;
+            bits = (bits ^ (bits >> 2)) & 0x10C30C30C30C30C3ull;
+            bits = (bits ^ (bits >> 4)) & 0x100F00F00F00F00Full;
+            bits = (bits ^ (bits >> 8)) & 0x1F0000FF0000FFull;
+            bits = (bits ^ (bits >> 16)) & 0x1F00000000FFFFull;
+            bits = (bits ^ (bits >> 32)) & 0x1FFFFF;
+
+            return static_cast<int32_t>(bits) + MINIMUM_COORDINATE;
+        }
+    };
+}
+
+namespace std
+{
+    template <>
+    struct hash<Invasion::World::ChunkKey>
+    {
+        std::size_t operator()(const Invasion::World::ChunkKey& key) const noexcept
+        {
+            return static_cast<std::size_t>(Invasion::Util::Hash::Mix(key.value));
+        }
+    };
+}
\ No newline at end of file
@@ -1,10 +1,14 @@
 #pragma once
 
+#include "ECS/CommandBuffer.hpp"
 #include "ECS/GameObjectManager.hpp"
 #include "Math/Transform.hpp"
+#include "Thread/Job.hpp"
 #include "Thread/ThreadPool.hpp"
+#include "Util/ConcurrentMap.hpp"
 #include "Util/CoordinateHelper.hpp"
 #include "World/Chunk.hpp"
+#include "World/ChunkKey.hpp"
 #include "World/TextureAtlasManager.hpp"
 
 using namespace Invasion::Thread;
@@ -19,24 +23,101 @@ namespace Invasion::World
         IWorld(const IWorld&) = delete;
         IWorld& operator=(const IWorld&) = delete;
 
-        void Update(Vector3f loaderPosition)
+        void Update(ThreadPool& threadPool, Vector3f loaderPosition)
         {
-            updateFuture = threadPool += ([this, loaderPosition] { UpdateInternal(loaderPosition); });
+            Vector3i chunkPosition = CoordinateHelper::WorldToChunkCoordinates(loaderPosition);
+            chunkPosition.y = 0;
+
+            if (updateJob)
+            {
+                if (!updateJob->IsComplete())
+                {
+                    // The loader left the area this update is streaming, so skip the generation and meshing jobs
+                    // that have not started yet; the next update is built around the new position.
+                    if (chunkPosition != updatePosition)
+                        generationToken.Cancel();
+
+                    return;
+                }
+
+                WaitForUpdate();
+            }
+
+            generationToken = CancellationToken::Create();
+            updatePosition = chunkPosition;
+
+            UnorderedMap<Vector3i, Shared<Job>, NoLock> generationJobs;
+            ArenaVector<Shared<Job>> meshJobs;
+
+            for (int x = -RENDER_DISTANCE; x <= RENDER_DISTANCE; ++x)
+            {
+                for (int z = -RENDER_DISTANCE; z <= RENDER_DISTANCE; ++z)
+                {
+                    Vector3i chunkCoord = chunkPosition + Vector3i(x, 0, z);
+
+                    if (!loadedChunks.Contains(ChunkKey(chunkCoord)))
+                        generationJobs[chunkCoord] = Job::Create(threadPool, [this, chunkCoord] { GenerateChunk(chunkCoord); }, TaskPriority::NORMAL, generationToken, "ChunkGeneration");
+                }
+            }
+
+            for (auto& [chunkCoord, generationJob] : generationJobs)
+            {
+                Shared<Job> meshJob = Job::Create(threadPool, [this, &threadPool, chunkCoord] { MeshChunk(threadPool, chunkCoord); }, TaskPriority::NORMAL, generationToken, "ChunkMesh");
+
+                meshJob->DependsOn(generationJob);
+
+                for (const Vector3i& offset : NeighborOffsets)
+                {
+                    Shared<Job> neighborJob;
+
+                    if (generationJobs.Find(chunkCoord + offset, neighborJob))
+                        meshJob->DependsOn(neighborJob);
+                }
+
+                meshJob->Submit();
+                meshJobs += meshJob;
+            }
+
+            for (auto& [chunkCoord, generationJob] : generationJobs)
+                generationJob->Submit();
+
+            updateJob = Job::WhenAll(threadPool, meshJobs);
         }
 
         void WaitForUpdate()
         {
-            if (updateFuture.valid())
+            if (!updateJob)
+                return;
+
+            updateJob->Wait();
+
+            if (updateJob->GetException())
             {
                 try
                 {
-                    updateFuture.get();
+                    std::rethrow_exception(updateJob->GetException());
                 }
                 catch (const std::exception& e)
                 {
-                    std::cerr << "Exception in UpdateInternal: " << e.what() << std::endl;
+                    Logger_WriteConsole(std::string("Exception in world update: ") + e.what(), LogLevel::ERROR);
+                }
+                catch (...)
+                {
+                    Logger_WriteConsole("Unknown exception in world update", LogLevel::ERROR);
                 }
             }
+
+            updateJob.reset();
+
+            FinishUpdate();
+        }
+
+        Shared<Chunk> GetChunk(const Vector3i& chunkCoord) const
+        {
+            Shared<Chunk> chunk;
+            loadedChunks.Find(ChunkKey(chunkCoord), chunk);
+
+            return chunk;
         }
 
         static IWorld& GetInstance()
@@ -49,101 +130,99 @@ namespace Invasion::World
 
     private:
 
-        IWorld() : threadPool(4) {} 
+        IWorld() = default;
 
-        void UpdateInternal(Vector3f loaderPosition)
+        // Runs on the main thread once every mesh job has finished, so the frame arena and the main thread's command
+        // buffer are safe to use and chunk GameObjects are never cleaned up while systems are running.
+        void FinishUpdate()
         {
-            Vector3i chunkPosition = CoordinateHelper::WorldToChunkCoordinates(loaderPosition);
-            chunkPosition.y = 0;
-
-            UnorderedMap<Vector3i, Shared<Chunk>> newLoadedChunks;
-            Vector<Future<Pair<Vector3i, Shared<Chunk>>>> futures;
+            ArenaSmallVector<ChunkKey, 32> chunksToUnload;
+            CommandBuffer& commands = CommandBuffer::GetLocal();
 
-            for (int x = -RENDER_DISTANCE; x <= RENDER_DISTANCE; ++x)
+            meshedChunks.ForEach([this, &commands](const ChunkKey& key, const Shared<Chunk>& chunk)
             {
-                for (int z = -RENDER_DISTANCE; z <= RENDER_DISTANCE; ++z)
-                {
-                    Vector3i chunkCoord = chunkPosition + Vector3i(x, 0, z);
+                loadedChunks.Insert(key, chunk);
 
-                    std::unique_lock<std::mutex> lock(mutex);
-
-                    if (!loadedChunks.Contains(chunkCoord))
-                    {
-                        lock.unlock();
-                        futures |= threadPool += ([this, chunkCoord] { return GenerateChunk(chunkCoord); });
-                    }
-                    else
-                    {
-                        newLoadedChunks[chunkCoord] = loadedChunks[chunkCoord];
-                        loadedChunks -= chunkCoord;
-                    }
-                }
-            }
+                commands.CreateEntity(chunk->GetGameObject());
+                commands.Register(chunk->GetGameObject(), false);
+            });
 
-            for (auto& future : futures)
-            {
-                auto [chunkCoord, chunk] = future.get();
-                LockGuard<Mutex> lock(mutex);
-                newLoadedChunks[chunkCoord] = chunk;
-            }
+            meshedChunks.Clear();
 
-            Vector<Vector3i> chunksToUnload;
+            generatedChunks.ForEach([this](const ChunkKey& key, const Shared<Chunk>& chunk)
             {
-                LockGuard<Mutex> lock(mutex);
+                if (!loadedChunks.Contains(key))
+                    chunk->GetGameObject()->CleanUp();
+            });
 
-                for (const auto& [chunkCoord, chunk] : loadedChunks)
-                {
-                    if (!newLoadedChunks.Contains(chunkCoord))
-                        chunksToUnload += chunkCoord;
-                }
-            }
+            generatedChunks.Clear();
 
-            chunksToUnload.ForEach([this](Vector3i& chunkCoord) { UnloadChunk(chunkCoord); });
+            // loadedChunks never holds more than the previous render box plus the chunks merged above, so almost every
+            // key falls inside [minimum, maximum] and a linear IsWithin pass is cheaper than walking a Morton range.
+            ChunkKey minimum(Vector3i(updatePosition.x - RENDER_DISTANCE, ChunkKey::MINIMUM_COORDINATE, updatePosition.z - RENDER_DISTANCE));
+            ChunkKey maximum(Vector3i(updatePosition.x + RENDER_DISTANCE, ChunkKey::MAXIMUM_COORDINATE, updatePosition.z + RENDER_DISTANCE));
 
+            loadedChunks.ForEach([&chunksToUnload, minimum, maximum](const ChunkKey& key, const Shared<Chunk>&)
             {
-                LockGuard<Mutex> lock(mutex);
-                loadedChunks = std::move(newLoadedChunks);
-            }
+                if (!key.IsWithin(minimum, maximum))
+                    chunksToUnload += key;
+            });
+
+            chunksToUnload.ForEach([this](ChunkKey& key) { UnloadChunk(key); });
         }
 
-        Pair<Vector3i, Shared<Chunk>> GenerateChunk(const Vector3i& position)
+        void GenerateChunk(const Vector3i& position)
         {
-            Shared<GameObject> chunkObject = GameObjectManager::GetInstance().Register(GameObject::Create(
-                Formatter::Format("Chunk_{}_{}_{}_", position.x, position.y, position.z)));
+            Shared<GameObject> chunkObject = GameObject::CreateDeferred("Chunk");
 
             Vector3f worldPosition = CoordinateHelper::ChunkToWorldCoordinates(position);
             chunkObject->GetTransform()->SetLocalPosition(worldPosition);
 
-            chunkObject->AddComponent(ShaderManager::GetInstance().Get("default"));
-            chunkObject->AddComponent(TextureAtlasManager::GetInstance().Get("default"));
+            chunkObject->AddComponent(ShaderManager::GetInstance().Get("default"_sid));
+            chunkObject->AddComponent(TextureAtlasManager::GetInstance().Get("default"_sid));
 
             chunkObject->AddComponent(Mesh::Create(Formatter::Format("Chunk_Mesh_{}_{}_{}_", position.x, position.y, position.z), {}, {}));
 
-            Shared<Chunk> chunk = chunkObject->AddComponent(Chunk::Create());
-            chunk->Generate();
+            generatedChunks.Insert(ChunkKey(position), chunkObject->AddComponent(Chunk::Create()));
+        }
+
+        void MeshChunk(ThreadPool& threadPool, const Vector3i& position)
+        {
+            Shared<Chunk> chunk;
 
-            return { position, std::move(chunk) };
+            if (generatedChunks.Find(ChunkKey(position), chunk))
+            {
+                chunk->Generate(threadPool);
+                meshedChunks.Insert(ChunkKey(position), chunk);
+            }
         }
 
-        Optional<Vector3i> UnloadChunk(const Vector3i& chunkCoord)
+        Optional<Vector3i> UnloadChunk(const ChunkKey& key)
         {
-            LockGuard<Mutex> lock(mutex);
+            Shared<Chunk> chunk;
 
-            if (loadedChunks.Contains(chunkCoord))
+            if (loadedChunks.Extract(key, chunk))
             {
-                Shared<Chunk> chunk = loadedChunks[chunkCoord];
-                GameObjectManager::GetInstance().Unregister(chunk->GetGameObject()->GetName());
+                CommandBuffer::GetLocal().Unregister(chunk->GetGameObject());
                 chunk.reset();
 
-                return chunkCoord;
+                return key.ToCoordinates();
             }
 
             return Optional<Vector3i>();
         }
 
-        Future<void> updateFuture;
-        Mutex mutex;
-        UnorderedMap<Vector3i, Shared<Chunk>> loadedChunks;
-        ThreadPool threadPool;
+        static inline const Vector3i NeighborOffsets[4] =
+        {
+            Vector3i(1, 0, 0), Vector3i(-1, 0, 0),
+            Vector3i(0, 0, 1), Vector3i(0, 0, -1)
+        };
+
+        Shared<Job> updateJob;
+        Vector3i updatePosition;
+        CancellationToken generationToken;
+        ConcurrentMap<ChunkKey, Shared<Chunk>> loadedChunks;
+        ConcurrentMap<ChunkKey, Shared<Chunk>> generatedChunks;
+        ConcurrentMap<ChunkKey, Shared<Chunk>> meshedChunks;
     };
 }
\ No newline at end of file
@@ -7,10 +7,15 @@
 #include "ECS/Component.hpp"
 #include "Math/Vector2.hpp"
 #include "Render/Renderer.hpp"
+#include "Thread/MainThreadDispatcher.hpp"
+#include "Thread/Task.hpp"
+#include "Thread/ThreadPool.hpp"
+#include "Util/StringId.hpp"
 #include "Util/Typedefs.hpp"
 
 using namespace Invasion::Core;
 using namespace Invasion::Math;
+using namespace Invasion::Thread;
 using namespace Invasion::Util;
 
 namespace fs = std::filesystem;
@@ -36,16 +41,16 @@ namespace Invasion::World
             Renderer::GetInstance().GetContext()->PSSetShaderResources(0, 1, shaderResourceView.GetAddressOf());
         }
 
-        Array<Vector2f, 4> GetTextureCoordinates(const String& textureName) const
+        Array<Vector2f, 4> GetTextureCoordinates(StringId textureName) const
         {
-            if (!lookupTable.Contains(textureName))
+            SubTextureInfo info;
+
+            if (!lookupTable.Find(textureName, info))
             {
-                Logger_WriteConsole("Texture not found: '" + textureName + "', I_WARN", LogLevel::WARNING);
+                Logger_WriteConsole("Texture not found: '" + textureName.ToString() + "', I_WARN", LogLevel::WARNING);
                 return Array<Vector2f, 4>();
             }
 
-            const SubTextureInfo& info = lookupTable[textureName];
-
             Array<Vector2f, 4> texCoords;
 
             texCoords[0] = info.position;
@@ -87,10 +92,32 @@ namespace Invasion::World
             result->outputDirectory = outputDirectory;
 
             result->Generate();
+            result->Upload();
 
             return std::move(result);
         }
 
+        // Loads, packs and saves the atlas on a pool worker, then hops to the main thread to create its GPU resources.
+        static Task<Shared<TextureAtlas>> CreateAsync(ThreadPool& threadPool, String name, String inputDirectory, String outputDirectory)
+        {
+            class Enabled : public TextureAtlas { };
+            Shared<TextureAtlas> result = std::make_shared<Enabled>();
+
+            result->name = std::move(name);
+            result->inputDirectory = std::move(inputDirectory);
+            result->outputDirectory = std::move(outputDirectory);
+
+            co_await threadPool.Schedule(TaskPriority::BACKGROUND);
+
+            result->Generate();
+
+            co_await MainThreadDispatcher::GetInstance().Schedule();
+
+            result->Upload();
+
+            co_return result;
+        }
+
 	private:
 
         TextureAtlas() = default;
@@ -119,7 +146,10 @@ namespace Invasion::World
 
             atlas = PackTextures();
             SaveAtlasAndLookupTable(outputDirectory.operator std::string());
+        }
 
+        void Upload()
+        {
             auto device = Renderer::GetInstance().GetDevice();
 
             HRESULT result = DirectX::CreateTexture(device.Get(), atlas.GetImages(), atlas.GetImageCount(), atlas.GetMetadata(), &texture);
@@ -127,6 +157,8 @@ namespace Invasion::World
             if (FAILED(result))
                 Logger_ThrowException("Failed to create texture from image", true);
 
+            residentMemory.Set(atlas.GetPixelsSize());
+
             D3D11_SHADER_RESOURCE_VIEW_DESC shaderResourceViewDescription = {};
 
             shaderResourceViewDescription.Format = atlas.GetMetadata().format;
@@ -244,12 +276,14 @@ namespace Invasion::World
         Vector<DirectX::ScratchImage> images;
         Vector<fs::path> filenames;
         DirectX::ScratchImage atlas;
-        UnorderedMap<String, SubTextureInfo> lookupTable;
+        FlatMap<StringId, SubTextureInfo, SharedMutexLock> lookupTable;
 
         D3D11_SAMPLER_DESC samplerDescription = {};
 
         ComPtr<ID3D11Resource> texture;
         ComPtr<ID3D11ShaderResourceView> shaderResourceView;
         ComPtr<ID3D11SamplerState> samplerState;
+
+        TrackedBytes residentMemory{ MemoryTag::ASSETS };
 	};
 }
\ No newline at end of file
@@ -14,12 +14,12 @@ namespace Invasion::World
 			textureAtlases += { textureAtlas->GetName(), textureAtlas };
 		}
 
-		Shared<TextureAtlas> Get(const String& name)
+		Shared<TextureAtlas> Get(StringId name)
 		{
 			return textureAtlases[name];
 		}
 
-		void Remove(const String& name)
+		void Remove(StringId name)
 		{
 			textureAtlases[name]->CleanUp_NoOverride();
 
@@ -40,7 +40,7 @@ namespace Invasion::World
 
 	private:
 
-		UnorderedMap<String, Shared<TextureAtlas>> textureAtlases;
+		FlatMap<StringId, Shared<TextureAtlas>, SharedMutexLock> textureAtlases;
 
 	};
 }
\ No newline at end of file